@@ -89,8 +89,16 @@ namespace SimFeedback.telemetry
                     IsConnected = true;
 
                     var received = socket.Receive(ref endpoint);
-                    var resp = Encoding.UTF8.GetString(received);
-                    TelemetryData telemetryData = ParseReponse(resp);
+                    TelemetryData telemetryData = IsBinaryFrame(received)
+                        ? ParseBinaryFrame(received)
+                        : ParseReponse(Encoding.UTF8.GetString(received));
+
+                    // a delta frame after a lost one waits for the next keyframe, truncated frames and other versions are dropped
+                    if (telemetryData == null)
+                    {
+                        sw.Restart();
+                        continue;
+                    }
 
                     IsRunning = true;
 
@@ -129,5 +137,91 @@ namespace SimFeedback.telemetry
 
             return telemetryData;
         }
+
+        // binary frames start with 'AFT2', see external_dll/shared/telemetry/tm_telemetry_frame.h
+        private const uint BinaryFrameMagic = 0x32544641;
+        private const ushort BinaryFrameVersion = 1;
+        private const int BinaryFrameHeaderSize = 24;
+        private const ushort BinaryFrameFloatValues = 1;
+        private const ushort BinaryFrameDelta = 2;
+
+        // the values of the last keyframe and the deltas applied since, delta frames only carry the changed channels
+        private double[] _binaryValues = new double[0];
+        private uint _binarySequence;
+        private bool _binaryValid;
+        private ushort _loggedBinaryVersion;
+
+        private static bool IsBinaryFrame(byte[] received)
+        {
+            return received.Length >= BinaryFrameHeaderSize && BitConverter.ToUInt32(received, 0) == BinaryFrameMagic;
+        }
+
+        private TelemetryData ParseBinaryFrame(byte[] received)
+        {
+            // another layout can not be parsed as this one, drop it and log each version once
+            ushort version = BitConverter.ToUInt16(received, 4);
+            if (version != BinaryFrameVersion)
+            {
+                if (version != _loggedBinaryVersion)
+                {
+                    Log(Name + "TelemetryProvider dropping binary frames of unsupported version " + version);
+                    _loggedBinaryVersion = version;
+                }
+                _binaryValid = false;
+                return null;
+            }
+
+            TelemetryData telemetryData = new TelemetryData();
+            ushort flags = BitConverter.ToUInt16(received, 6);
+            uint sequence = BitConverter.ToUInt32(received, 8);
+            int channelCount = BitConverter.ToUInt16(received, 12);
+            int maskWords = (channelCount + 63) / 64;
+            bool floatValues = (flags & BinaryFrameFloatValues) != 0;
+            bool delta = (flags & BinaryFrameDelta) != 0;
+
+            // a frame cut short is dropped, a delta frame after it can only apply to the next keyframe
+            if (BinaryFrameHeaderSize + 8 * maskWords > received.Length)
+            {
+                _binaryValid = false;
+                return null;
+            }
+
+            if (delta && (!_binaryValid || sequence != _binarySequence + 1 || _binaryValues.Length != Math.Max(channelCount, 11)))
+            {
+                _binaryValid = false;
+                return null;
+            }
+
+            // values are sent unscaled, TelemetryData expects the legacy values multiplied by 1000
+            double[] values = delta ? _binaryValues : new double[Math.Max(channelCount, 11)];
+            int pos = BinaryFrameHeaderSize + 8 * maskWords;
+            for (int i = 0; i < channelCount; i++)
+            {
+                ulong mask = BitConverter.ToUInt64(received, BinaryFrameHeaderSize + 8 * (i / 64));
+                if ((mask & (1UL << (i % 64))) == 0) continue;
+                if (pos + (floatValues ? 4 : 8) > received.Length)
+                {
+                    _binaryValid = false;
+                    return null;
+                }
+                values[i] = (floatValues ? BitConverter.ToSingle(received, pos) : BitConverter.ToDouble(received, pos)) * 1000;
+                pos += floatValues ? 4 : 8;
+            }
+
+            _binaryValues = values;
+            _binarySequence = sequence;
+            _binaryValid = true;
+
+            telemetryData.Pitch = (float)values[0];
+            telemetryData.Roll = (float)values[1];
+            telemetryData.Yaw = (float)values[2];
+            telemetryData.Sway = (float)values[3];
+            telemetryData.Surge = (float)values[5];
+            telemetryData.Heave = (float)values[8];
+            telemetryData.AirSpeed = (float)values[9];
+            telemetryData.GroundSpeed = (float)values[10];
+
+            return telemetryData;
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,1826 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file aerofly_fs_2_external_dll_benchmark.cpp
+//
+// measures the code that the telemetry dll runs on every simulator frame
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../shared/input/tm_external_message.h"
+#include "../shared/telemetry/tm_telemetry_frame.h"
+#include "../shared/telemetry/tm_telemetry_shm.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_channel_plan.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_command_listener.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_external_message_view.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_frame_pacing.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_frame_recorder.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_local_frame.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_math_batch.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_message_catalog.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_message_list.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_output_scheduler.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_platform.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_spsc_queue.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_stage_stats.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_state_table.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_string_pool.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_triple_buffer.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_udp_sender.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_washout_filter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// a minimal benchmark harness, runs a function N times and prints the time per call. every result
+// is one line "name value unit", with --csv "name,value,unit" so runs of two commits can be diffed.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static bool BenchmarkCSV = false;
+
+static void PrintResult( const char *name, const double value, const char *unit )
+{
+  if( BenchmarkCSV ) { printf( "%s,%.1f,%s\n", name, value, unit ); }
+  else               { printf( "%-40s %12.1f %s\n", name, value, unit ); }
+}
+
+// a deviation against its bound, a check above its bound fails the whole run
+static bool BenchmarkFailed = false;
+
+static void CheckResult( const char *name, const double deviation, const double bound )
+{
+  const bool failed = !( deviation <= bound );
+  BenchmarkFailed |= failed;
+
+  if( BenchmarkCSV ) { printf( "%s,%.3e,%s\n", name, deviation, failed ? "failed" : "ok" ); }
+  else               { printf( "%-40s %12.3e %s (bound %.3e)\n", name, deviation, failed ? "FAILED" : "ok", bound ); }
+}
+
+// 'bytes_per_op' is printed as a second result of the same name when it is not 0
+template<typename F> static double RunBenchmark( const char *name, const tm_uint32 iterations, F &&function, const tm_uint32 bytes_per_op = 0 )
+{
+  // warm up caches, branch predictors and lazily initialized os state
+  for( tm_uint32 i = 0; i < iterations / 10 + 1; ++i ) { function(); }
+
+  const auto start = std::chrono::steady_clock::now();
+  for( tm_uint32 i = 0; i < iterations; ++i ) { function(); }
+  const auto stop = std::chrono::steady_clock::now();
+
+  const double ns_per_op = std::chrono::duration<double, std::nano>( stop - start ).count() / iterations;
+  PrintResult( name, ns_per_op, "ns/op" );
+  if( bytes_per_op != 0 ) { PrintResult( name, bytes_per_op, "bytes/op" ); }
+  return ns_per_op;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// per-frame send cost
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static const char BenchmarkMessage[] = "12;-3;0;1;-2;3;51234;-1234;812;51000;50000";
+
+// what the dll used to do on every frame: create, bind and resolve, then send. the old code never
+// closed the socket, the benchmark does to not run out of handles.
+static void SendPerFrameSocket()
+{
+  const tm_socket sock = socket( AF_INET, SOCK_DGRAM, 0 );
+  sockaddr_in address_listen = {};
+  address_listen.sin_family = AF_INET;
+  bind( sock, reinterpret_cast<sockaddr*>( &address_listen ), sizeof( address_listen ) );
+
+  sockaddr_storage address_destination = {};
+  tm_uint32        address_length      = 0;
+  tm_socket_resolve( "127.0.0.1", "4123", address_destination, address_length );
+
+  sendto( sock, BenchmarkMessage, sizeof( BenchmarkMessage ) - 1, 0, reinterpret_cast<sockaddr*>( &address_destination ), address_length );
+  tm_socket_close( sock );
+}
+
+static void BenchmarkSend()
+{
+  tm_socket_startup();
+
+  const double per_frame = RunBenchmark( "send/per_frame_socket", 20000, SendPerFrameSocket );
+
+  tm_udp_sender sender;
+  sender.Open( "127.0.0.1", "4123" );
+  const double persistent = RunBenchmark( "send/persistent_sender", 20000, [&sender]() { sender.Send( BenchmarkMessage, sizeof( BenchmarkMessage ) - 1 ); } );
+  sender.Close();
+
+  PrintResult( "send/speedup", per_frame / persistent, "x" );
+
+  // four destinations, one sendto each against one batched call
+  const char *services[] = { "4123", "4124", "4125", "4126" };
+
+  tm_udp_sender senders[4];
+  for( tm_uint32 i = 0; i < 4; ++i ) { senders[i].Open( "127.0.0.1", services[i] ); }
+  const double loop = RunBenchmark( "send/sendto_4_destinations", 20000, [&senders]()
+  {
+    for( const auto &s : senders ) { s.Send( BenchmarkMessage, sizeof( BenchmarkMessage ) - 1 ); }
+  } );
+  for( auto &s : senders ) { s.Close(); }
+
+  tm_udp_fanout      fanout;
+  tm_udp_datagram    datagrams[4];
+  tm_udp_send_result results[4];
+  fanout.Open( 1 );
+  for( tm_uint32 i = 0; i < 4; ++i ) { datagrams[i] = { BenchmarkMessage, sizeof( BenchmarkMessage ) - 1, static_cast<tm_uint32>( fanout.AddDestination( "127.0.0.1", services[i] ) ) }; }
+  const double batch = RunBenchmark( "send/fanout_4_destinations", 20000, [&]() { fanout.Send( datagrams, 4, results ); } );
+  fanout.Close();
+
+  PrintResult( "send/fanout_speedup", loop / batch, "x" );
+
+  tm_socket_cleanup();
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// frame encoding, legacy csv against the binary format. decode mimics the consumer side, which
+// splits the text at ';' and parses every value.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static tm_telemetry_frame CreateBenchmarkFrame()
+{
+  const tm_double values[11] = { 0.0523, -0.1745, 0.0012, 0.0105, -0.0021, 0.0033, 51.234, -1.234, 0.812, 51.0, 50.0 };
+
+  tm_telemetry_frame frame;
+  frame.Sequence = 4711;
+  frame.SimTime  = 1234.5678;
+  frame.SetAllChannels( 11 );
+  for( tm_uint32 i = 0; i < 11; ++i ) { frame.Values[i] = values[i]; }
+  return frame;
+}
+
+static void BenchmarkFormat()
+{
+  const tm_telemetry_frame frame = CreateBenchmarkFrame();
+  tm_telemetry_frame       decoded;
+  tm_uint8                 datagram[tm_telemetry_max_datagram_size];
+  tm_uint32                size    = 0;
+  volatile double          sink    = 0;
+
+  RunBenchmark( "format/csv_encode_decode", 200000, [&]()
+  {
+    size = frame.EncodeCSV( reinterpret_cast<char*>( datagram ), sizeof( datagram ) );
+    datagram[size] = 0;
+
+    const char *p = reinterpret_cast<const char*>( datagram );
+    for( tm_uint32 i = 0; i < 11 && *p != 0; ++i )
+    {
+      char *end = nullptr;
+      decoded.Values[i] = strtod( p, &end ) / 1000;
+      p = *end == ';' ? end + 1 : end;
+    }
+    sink = decoded.Values[10];
+  } );
+  PrintResult( "format/csv_size", size, "bytes/op" );
+
+  RunBenchmark( "format/binary_encode_decode", 200000, [&]()
+  {
+    size = frame.EncodeBinary( datagram, sizeof( datagram ), false );
+    decoded.DecodeBinary( datagram, size );
+    sink = decoded.Values[10];
+  } );
+  PrintResult( "format/binary_size", size, "bytes/op" );
+
+  RunBenchmark( "format/binary_float_encode_decode", 200000, [&]()
+  {
+    size = frame.EncodeBinary( datagram, sizeof( datagram ), true );
+    decoded.DecodeBinary( datagram, size );
+    sink = decoded.Values[10];
+  } );
+  PrintResult( "format/binary_float_size", size, "bytes/op" );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// delta frames over a minute of a flight-like session with 128 values, a quarter of them changing
+// every frame and the others every few seconds like the synthetic frames of the replay host:
+// bytes per frame and encode cost against full frames, and the state a consumer rebuilds against
+// the values sent, also when every 50th datagram is lost.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkDelta()
+{
+  const tm_uint32 num_values = 128;
+  const tm_uint32 num_frames = 3600;
+
+  std::vector<tm_telemetry_frame> frames( num_frames );
+  for( tm_uint32 f = 0; f < num_frames; ++f )
+  {
+    const double time = f / 60.0;
+    frames[f].Sequence = f;
+    frames[f].SimTime  = time;
+    frames[f].SetAllChannels( num_values );
+    for( tm_uint32 i = 0; i < num_values; ++i )
+    {
+      const double period = 2.0 + i % 11;
+      frames[f].Values[i] = sin( 0.5 * ( i % 4 == 0 ? time : floor( time / period ) * period ) + i );
+    }
+  }
+
+  tm_uint8        datagram[tm_telemetry_max_datagram_size];
+  tm_uint32       step = 0;
+  volatile double sink = 0;
+
+  double full_bytes = 0;
+  for( const auto &frame : frames ) { full_bytes += frame.EncodeBinary( datagram, sizeof( datagram ), false ); }
+  PrintResult( "delta/full_bytes_per_frame", full_bytes / num_frames, "bytes" );
+  RunBenchmark( "delta/full_encode", 200000, [&]() { sink = frames[++step % num_frames].EncodeBinary( datagram, sizeof( datagram ), false ); } );
+
+  double epsilons[num_values];
+  for( const double epsilon : { 0.0, 1e-3 } )
+  {
+    for( tm_uint32 i = 0; i < num_values; ++i ) { epsilons[i] = epsilon; }
+
+    // the whole minute once, datagrams kept for the consumer side
+    tm_telemetry_delta_encoder         encoder;
+    std::vector<std::vector<tm_uint8>> datagrams( num_frames );
+    double                             delta_bytes = 0;
+    encoder.Configure( 60, nullptr, epsilons, num_values );
+    for( tm_uint32 f = 0; f < num_frames; ++f )
+    {
+      const tm_uint32 size = encoder.Encode( frames[f], datagram, sizeof( datagram ), false );
+      datagrams[f].assign( datagram, datagram + size );
+      delta_bytes += size;
+    }
+
+    char name[64];
+    snprintf( name, sizeof( name ), "delta/keyframe_60_epsilon_%g_bytes_per_frame", epsilon );
+    PrintResult( name, delta_bytes / num_frames, "bytes" );
+
+    snprintf( name, sizeof( name ), "delta/keyframe_60_epsilon_%g_encode", epsilon );
+    RunBenchmark( name, 200000, [&]() { sink = encoder.Encode( frames[++step % num_frames], datagram, sizeof( datagram ), false ); } );
+
+    // the consumer: every value within epsilon of the one sent, once it has a keyframe
+    for( const tm_uint32 loss : { 0u, 50u } )
+    {
+      tm_telemetry_frame_state state;
+      double                   deviation = 0;
+      tm_uint32                waiting   = 0;
+      for( tm_uint32 f = 0; f < num_frames; ++f )
+      {
+        if( loss > 0 && f % loss == loss - 1 ) { continue; }
+        if( !state.Apply( datagrams[f].data(), static_cast<tm_uint32>( datagrams[f].size() ) ) ) { ++waiting; continue; }
+
+        for( tm_uint32 i = 0; i < num_values; ++i ) { deviation = fmax( deviation, fabs( state.GetFrame().Values[i] - frames[f].Values[i] ) ); }
+      }
+
+      snprintf( name, sizeof( name ), "delta/epsilon_%g_loss_%u_rebuilt_deviation", epsilon, loss );
+      CheckResult( name, deviation, epsilon );
+      snprintf( name, sizeof( name ), "delta/epsilon_%g_loss_%u_frames_waiting", epsilon, loss );
+      PrintResult( name, waiting, "frames" );
+    }
+
+    if( epsilon == 0 )
+    {
+      tm_telemetry_frame_state state;
+      RunBenchmark( "delta/consumer_apply", 200000, [&]()
+      {
+        const auto &d = datagrams[++step % num_frames];
+        sink = state.Apply( d.data(), static_cast<tm_uint32>( d.size() ) ) ? state.GetFrame().Values[0] : 0;
+      } );
+    }
+  }
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// handing a frame to the sender thread, this replaces encode + sendto on the simulation thread
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkQueue()
+{
+  const tm_telemetry_frame frame = CreateBenchmarkFrame();
+  tm_telemetry_frame       popped;
+  tm_uint8                 datagram[tm_telemetry_max_datagram_size];
+
+  tm_spsc_queue<tm_telemetry_frame> queue;
+  queue.Reset( 16 );
+
+  tm_udp_sender sender;
+  sender.Open( "127.0.0.1", "4123" );
+  RunBenchmark( "queue/inline_encode_send", 20000, [&]()
+  {
+    const tm_uint32 size = frame.EncodeCSV( reinterpret_cast<char*>( datagram ), sizeof( datagram ) );
+    sender.Send( datagram, size );
+  } );
+  sender.Close();
+
+  RunBenchmark( "queue/push_pop", 1000000, [&]()
+  {
+    queue.Push( frame, tm_queue_full_policy::DropOldest );
+    queue.Pop( popped );
+  } );
+
+  RunBenchmark( "queue/push_full_drop_oldest", 1000000, [&]() { queue.Push( frame, tm_queue_full_policy::DropOldest ); } );
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// message id dispatch over every id in MESSAGE_LIST, one frame that contains each message once
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkDispatch()
+{
+  volatile double sink  = 0;
+  double          value = 0;
+
+  RunBenchmark( "dispatch/compare_chain_7_channels", 20000, [&]()
+  {
+    for( const auto id : tm_message_ids )
+    {
+      const tm_string_hash hash( id );
+      if( hash == "Aircraft.Pitch" )                  { value += 1; }
+      else if( hash == "Aircraft.Bank" )              { value += 2; }
+      else if( hash == "Aircraft.RateOfTurn" )        { value += 3; }
+      else if( hash == "Aircraft.AngularVelocity" )   { value += 4; }
+      else if( hash == "Aircraft.Velocity" )          { value += 5; }
+      else if( hash == "Aircraft.IndicatedAirspeed" ) { value += 6; }
+      else if( hash == "Aircraft.GroundSpeed" )       { value += 7; }
+    }
+    sink = value;
+  } );
+
+  RunBenchmark( "dispatch/linear_search_all_channels", 2000, [&]()
+  {
+    for( const auto id : tm_message_ids )
+    {
+      for( tm_uint32 i = 0; i < tm_message_count; ++i )
+      {
+        if( tm_message_ids[i] == id ) { value += i; break; }
+      }
+    }
+    sink = value;
+  } );
+
+  RunBenchmark( "dispatch/perfect_hash_all_channels", 20000, [&]()
+  {
+    for( const auto id : tm_message_ids )
+    {
+      const tm_message_index index = tm_message_lookup( id );
+      switch( index )
+      {
+        case tm_message_index::AircraftPitch:             value += 1; break;
+        case tm_message_index::AircraftBank:              value += 2; break;
+        case tm_message_index::AircraftRateOfTurn:        value += 3; break;
+        case tm_message_index::AircraftAngularVelocity:   value += 4; break;
+        case tm_message_index::AircraftVelocity:          value += 5; break;
+        case tm_message_index::AircraftIndicatedAirspeed: value += 6; break;
+        case tm_message_index::AircraftGroundSpeed:       value += 7; break;
+        default:                                          value += static_cast<tm_uint16>( index ) & 1; break;
+      }
+    }
+    sink = value;
+  } );
+
+  PrintResult( "dispatch/messages", tm_message_count, "messages/op" );
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// a received byte stream as the simulation builds it. messages are taken from MESSAGE_LIST with a
+// stride of 97, which is coprime to the number of messages, so every size gets the mix of the
+// whole list, mostly Double with some Vector3d and String8, instead of its first entries only.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static tm_uint32 CreateMessageStream( const tm_uint32 num_messages, std::vector<tm_uint8> &byte_stream )
+{
+  byte_stream.assign( num_messages * tm_external_message::GetMaxSize(), 0 );
+
+  tm_uint32 pos = 0;
+  for( tm_uint32 i = 0; i < num_messages; ++i )
+  {
+    const tm_uint32 entry     = ( i * 97 ) % tm_message_count;
+    const auto      data_type = tm_message_catalog[entry].DataType;
+    const auto      data_size = static_cast<tm_uint32>( tm_msg_data_type_size( data_type ) );
+
+    tm_msg_header header( tm_message_ids[entry], data_type, tm_msg_flag::Value, tm_msg_access::Read, tm_msg_unit::None );
+    header.MessageSize = static_cast<tm_uint16>( sizeof( tm_msg_header ) + data_size );
+    memcpy( &byte_stream[pos], &header, sizeof( header ) );
+    pos += sizeof( header );
+
+    if( data_type == tm_msg_data_type::String || data_type == tm_msg_data_type::String8 )
+    {
+      snprintf( reinterpret_cast<char*>( &byte_stream[pos] ), data_size, "%s", tm_message_id_names[entry] );
+    }
+    else
+    {
+      for( tm_uint32 k = 0; k < data_size / sizeof( double ); ++k )
+      {
+        const double value = 0.001 * i + k;
+        memcpy( &byte_stream[pos + k * sizeof( double )], &value, sizeof( double ) );
+      }
+    }
+    pos += data_size;
+  }
+
+  byte_stream.resize( pos );
+  return pos;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the tm_external_message calls and the steps of the original Update one by one, per frame of
+// 10, 100 and 450 messages. name lookup and formatting are measured as the original dll did them,
+// a linear search over all names and one sprintf of the 11 values.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static const char *GetMessageNameLinear( const tm_uint64 message_id )
+{
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    if( tm_message_ids[i] == message_id ) { return tm_message_id_names[i]; }
+  }
+  return "unknown";
+}
+
+static void BenchmarkMessages()
+{
+  std::vector<tm_uint8>            byte_stream;
+  std::vector<tm_uint8>            written;
+  std::vector<tm_external_message> message_list;
+  volatile double                  sink = 0;
+
+  for( const tm_uint32 num_messages : { 10u, 100u, 450u } )
+  {
+    const tm_uint32 byte_stream_size = CreateMessageStream( num_messages, byte_stream );
+    const tm_uint32 iterations       = 2000000 / num_messages;
+    char name[64];
+
+    message_list.clear();
+    tm_uint32 pos = 0;
+    for( tm_uint32 i = 0; i < num_messages; ++i ) { message_list.emplace_back( tm_external_message::GetFromByteStream( byte_stream.data(), pos ) ); }
+    written.assign( byte_stream_size, 0 );
+
+    snprintf( name, sizeof( name ), "message/get_from_byte_stream_%u", num_messages );
+    RunBenchmark( name, iterations, [&]()
+    {
+      double    sum = 0;
+      tm_uint32 pos = 0;
+      for( tm_uint32 i = 0; i < num_messages; ++i )
+      {
+        const auto message = tm_external_message::GetFromByteStream( byte_stream.data(), pos );
+        sum += static_cast<double>( message.GetDataType() );
+      }
+      sink = sum;
+    }, byte_stream_size );
+
+    // headers only, the data is skipped with the size in the header
+    snprintf( name, sizeof( name ), "message/get_header_from_byte_stream_%u", num_messages );
+    RunBenchmark( name, iterations, [&]()
+    {
+      tm_uint64 sum = 0;
+      tm_uint32 pos = 0;
+      for( tm_uint32 i = 0; i < num_messages; ++i )
+      {
+        const tm_msg_header header = tm_external_message::GetHeaderFromByteStream( byte_stream.data(), pos );
+        pos += header.MessageSize - static_cast<tm_uint32>( sizeof( tm_msg_header ) );
+        sum += header.MessageID;
+      }
+      sink = static_cast<double>( sum );
+    }, byte_stream_size );
+
+    snprintf( name, sizeof( name ), "message/add_to_byte_stream_%u", num_messages );
+    RunBenchmark( name, iterations, [&]()
+    {
+      tm_uint32 pos = 0, count = 0;
+      for( const auto &message : message_list ) { message.AddToByteStream( written.data(), pos, count ); }
+      sink = written[pos - 1] + count;
+    }, byte_stream_size );
+
+    snprintf( name, sizeof( name ), "message/hash_compare_chain_%u", num_messages );
+    RunBenchmark( name, iterations, [&]()
+    {
+      double value = 0;
+      for( const auto &message : message_list )
+      {
+        if( message.GetStringHash() == "Aircraft.Pitch" )                  { value += 1; }
+        else if( message.GetStringHash() == "Aircraft.Bank" )              { value += 2; }
+        else if( message.GetStringHash() == "Aircraft.RateOfTurn" )        { value += 3; }
+        else if( message.GetStringHash() == "Aircraft.AngularVelocity" )   { value += 4; }
+        else if( message.GetStringHash() == "Aircraft.Velocity" )          { value += 5; }
+        else if( message.GetStringHash() == "Aircraft.IndicatedAirspeed" ) { value += 6; }
+        else if( message.GetStringHash() == "Aircraft.GroundSpeed" )       { value += 7; }
+      }
+      sink = value;
+    } );
+
+    snprintf( name, sizeof( name ), "message/get_message_name_linear_%u", num_messages );
+    RunBenchmark( name, iterations / 10, [&]()
+    {
+      tm_uint32 length = 0;
+      for( const auto &message : message_list ) { length += static_cast<tm_uint32>( GetMessageNameLinear( message.GetStringHash().GetHash() )[0] ); }
+      sink = length;
+    } );
+
+    snprintf( name, sizeof( name ), "message/get_message_name_catalog_%u", num_messages );
+    RunBenchmark( name, iterations, [&]()
+    {
+      tm_uint32 length = 0;
+      for( const auto &message : message_list ) { length += static_cast<tm_uint32>( tm_message_catalog_get_name( message.GetStringHash().GetHash() )[0] ); }
+      sink = length;
+    } );
+  }
+
+  // sprintf_s of the original dll, snprintf is the portable equivalent
+  const tm_double values[11] = { 0.0523, -0.1745, 0.0012, 0.0105, -0.0021, 0.0033, 51.234, -1.234, 0.812, 51.0, 50.0 };
+  char            text[512];
+  int             length = 0;
+  RunBenchmark( "message/sprintf_format_11_values", 200000, [&]()
+  {
+    length = snprintf( text, sizeof( text ), "%lld;%lld;%lld;%lld;%lld;%lld;%lld;%lld;%lld;%lld;%lld",
+                       static_cast<long long>( values[0] * 1000 ), static_cast<long long>( values[1] * 1000 ), static_cast<long long>( values[2] * 1000 ),
+                       static_cast<long long>( values[3] * 1000 ), static_cast<long long>( values[4] * 1000 ), static_cast<long long>( values[5] * 1000 ),
+                       static_cast<long long>( values[6] * 1000 ), static_cast<long long>( values[7] * 1000 ), static_cast<long long>( values[8] * 1000 ),
+                       static_cast<long long>( values[9] * 1000 ), static_cast<long long>( values[10] * 1000 ) );
+    sink = text[length - 1];
+  } );
+  PrintResult( "message/sprintf_format_11_values", length, "bytes/op" );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// reading a received frame, copying every message into a vector against views into the stream
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename T> static double SumMessageValues( const T &message )
+{
+  switch( message.GetDataType() )
+  {
+    case tm_msg_data_type::Double:   return message.GetDouble();
+    case tm_msg_data_type::Vector3d: return message.GetVector3d().x;
+    case tm_msg_data_type::Vector4d: return message.GetVector4d().w;
+    default:                         return static_cast<double>( message.GetID() & 1 );
+  }
+}
+
+static void BenchmarkReceive()
+{
+  std::vector<tm_uint8>            byte_stream;
+  std::vector<tm_external_message> message_list;
+  volatile double                  sink = 0;
+
+  for( const tm_uint32 num_messages : { 10u, 100u, 450u } )
+  {
+    const tm_uint32 byte_stream_size = CreateMessageStream( num_messages, byte_stream );
+    char name[64];
+
+    snprintf( name, sizeof( name ), "receive/copy_%u", num_messages );
+    RunBenchmark( name, 2000000 / num_messages, [&]()
+    {
+      message_list.clear();
+      tm_uint32 pos = 0;
+      for( tm_uint32 i = 0; i < num_messages; ++i )
+      {
+        message_list.emplace_back( tm_external_message::GetFromByteStream( byte_stream.data(), pos ) );
+      }
+
+      double sum = 0;
+      for( const auto &message : message_list ) { sum += SumMessageValues( message ); }
+      sink = sum;
+    } );
+
+    snprintf( name, sizeof( name ), "receive/view_%u", num_messages );
+    RunBenchmark( name, 2000000 / num_messages, [&]()
+    {
+      double sum = 0;
+      for( const auto message : tm_external_message_stream( byte_stream.data(), byte_stream_size, num_messages ) ) { sum += SumMessageValues( message ); }
+      sink = sum;
+    } );
+  }
+
+  // payloads shorter than their type, the last one at the very end of the stream. the view reads
+  // the missing bytes as 0 like the zero filled copy instead of the next header.
+  const tm_message_index    short_messages[] = { tm_message_index::AircraftVelocity, tm_message_index::AircraftPitch, tm_message_index::AircraftOrientation,
+                                                 tm_message_index::AircraftOnGround, tm_message_index::AircraftPosition };
+  const tm_msg_data_type    short_types[]    = { tm_msg_data_type::Vector3d, tm_msg_data_type::Double, tm_msg_data_type::Vector4d,
+                                                 tm_msg_data_type::Int, tm_msg_data_type::Vector3d };
+  const tm_uint32           short_sizes[]    = { 8, 0, 20, 4, 16 };
+  std::vector<tm_uint8>     short_stream;
+  for( tm_uint32 i = 0; i < 5; ++i )
+  {
+    tm_msg_header header( tm_message_ids[static_cast<tm_uint32>( short_messages[i] )], short_types[i], tm_msg_flag::Value, tm_msg_access::Read, tm_msg_unit::None );
+    header.MessageSize = static_cast<tm_uint16>( sizeof( tm_msg_header ) + short_sizes[i] );
+
+    const size_t pos = short_stream.size();
+    short_stream.resize( pos + header.MessageSize );
+    memcpy( &short_stream[pos], &header, sizeof( header ) );
+    for( tm_uint32 k = 0; k < short_sizes[i]; ++k ) { short_stream[pos + sizeof( header ) + k] = static_cast<tm_uint8>( 0x40 + k ); }
+  }
+
+  double    short_mismatches = 0;
+  tm_uint32 pos              = 0;
+  for( const auto message : tm_external_message_stream( short_stream.data(), static_cast<tm_uint32>( short_stream.size() ), 5 ) )
+  {
+    const tm_external_message copy = tm_external_message::GetFromByteStream( short_stream.data(), pos );
+    switch( message.GetDataType() )
+    {
+      case tm_msg_data_type::Int:      short_mismatches += message.GetInt() != copy.GetInt() ? 1 : 0; break;
+      case tm_msg_data_type::Double:   short_mismatches += message.GetDouble() != copy.GetDouble() ? 1 : 0; break;
+      case tm_msg_data_type::Vector3d: short_mismatches += message.GetVector3d().x != copy.GetVector3d().x || message.GetVector3d().y != copy.GetVector3d().y ||
+                                                           message.GetVector3d().z != copy.GetVector3d().z ? 1 : 0; break;
+      case tm_msg_data_type::Vector4d: short_mismatches += message.GetVector4d().x != copy.GetVector4d().x || message.GetVector4d().y != copy.GetVector4d().y ||
+                                                           message.GetVector4d().z != copy.GetVector4d().z || message.GetVector4d().w != copy.GetVector4d().w ? 1 : 0; break;
+      default: break;
+    }
+  }
+  CheckResult( "receive/short_payload_mismatches", short_mismatches, 0 );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// extraction of the subscribed channels from one received frame
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkPlan()
+{
+  std::vector<tm_uint8> byte_stream;
+  tm_telemetry_frame    frame;
+  volatile double       sink = 0;
+
+  tm_channel_plan default_plan;
+  for( const auto &subscription : tm_channel_default_subscriptions ) { default_plan.Add( subscription ); }
+
+  // as many scalar channels as fit into a frame
+  tm_channel_plan full_plan;
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    tm_channel_subscription subscription;
+    subscription.Index = static_cast<tm_message_index>( i );
+    if( tm_message_catalog[i].DataType == tm_msg_data_type::Double ) { full_plan.Add( subscription ); }
+  }
+
+  for( const tm_uint32 num_messages : { 10u, 100u, 450u } )
+  {
+    const tm_uint32 byte_stream_size = CreateMessageStream( num_messages, byte_stream );
+    char name[64];
+
+    for( const tm_channel_plan *plan : { &default_plan, &full_plan } )
+    {
+      snprintf( name, sizeof( name ), "plan/extract_%u_values_%u", plan->GetNumValues(), num_messages );
+      RunBenchmark( name, 2000000 / num_messages, [&]()
+      {
+        plan->BeginFrame( frame );
+        for( const auto message : tm_external_message_stream( byte_stream.data(), byte_stream_size, num_messages ) ) { plan->Extract( message, frame ); }
+        sink = frame.Values[0];
+      } );
+    }
+  }
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the washout filter once per frame, with a constant delta_time and with one that changes every
+// frame, which recomputes the coefficients
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkWashout()
+{
+  tm_washout_settings settings;
+  settings.Enabled = true;
+
+  tm_washout_filter filter;
+  filter.Configure( settings );
+
+  double          values[tm_washout_num_channels];
+  tm_uint32       step = 0;
+  volatile double sink = 0;
+
+  for( const bool varying : { false, true } )
+  {
+    RunBenchmark( varying ? "washout/update_varying_delta_time" : "washout/update_constant_delta_time", 1000000, [&]()
+    {
+      const double t = ( ++step & 255 ) * 0.01;
+      filter.SetSpecificForce( { t, -t, 9.81 } );
+      filter.SetAngularVelocity( { 0, 0, t } );
+      filter.Update( varying && ( step & 1 ) != 0 ? 1.0 / 50 : 1.0 / 60 );
+      filter.GetOutputs( values );
+      sink = values[0];
+    } );
+  }
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// velocity, wind and gravity in the local frame: the coordinate helpers for every vector against
+// the cached basis and one batched rotation. the checks compare the cached basis with the exact
+// one at positions up to the threshold away, all over the globe.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static tm_vector3d ToLocalExact( const tm_vector3d &position, const tm_vector3d &v )
+{
+  const tm_vector3d east  = tmcoordinates_GetEastAt( position );
+  const tm_vector3d north = tmcoordinates_GetNorthAt( position );
+  const tm_vector3d up    = tmcoordinates_GetUpAt( position );
+  return { east.x * v.x + east.y * v.y + east.z * v.z, north.x * v.x + north.y * v.y + north.z * v.z, up.x * v.x + up.y * v.y + up.z * v.z };
+}
+
+static void BenchmarkLocalFrame()
+{
+  const double threshold = 100.0;
+  const double bound     = threshold / 6.33e6;     // see tm_local_frame.h
+
+  tm_vector3d     position = tmcoordinates_GlobalFromLonLat( { 0.15, 0.84 }, 1000 );
+  tm_vector3d     vectors[3] = { { 120, -45, 3 }, { 5, 2, -1 }, { 0, 0, -9.81 } };
+  tm_vector3d     local[3];
+  tm_uint32       step = 0;
+  volatile double sink = 0;
+
+  // 4 m per frame, 240 m/s at 60 fps
+  RunBenchmark( "local/helpers_3_vectors", 1000000, [&]()
+  {
+    position.x += 4.0;
+    for( tm_uint32 i = 0; i < 3; ++i ) { local[i] = ToLocalExact( position, vectors[i] ); }
+    sink = local[2].z;
+  } );
+
+  tm_local_frame frame;
+  frame.SetThreshold( threshold );
+  RunBenchmark( "local/cached_batch_3_vectors", 1000000, [&]()
+  {
+    position.x += 4.0;
+    frame.Update( position );
+    frame.ToLocal( &vectors[0].x, &local[0].x, 3, 3, tm_local_frame_axes::ENU );
+    sink = local[2].z;
+  } );
+  PrintResult( "local/frames_per_recompute", 1000000.0 * 1.1 / static_cast<double>( frame.GetNumComputed() ), "frames" );
+
+  // worst case: the basis is computed, then the aircraft moves just up to the threshold, which
+  // shrinks with cos( latitude )
+  double max_error = 0, max_batch_difference = 0;
+  for( tm_uint32 i = 0; i < 20000; ++i )
+  {
+    ++step;
+    const double      lon    = ( step * 0.6180339887 - floor( step * 0.6180339887 ) ) * 6.283185307 - 3.141592654;
+    const double      lat    = ( step * 0.7548776662 - floor( step * 0.7548776662 ) ) * 3.1 - 1.55;
+    const tm_vector3d origin = tmcoordinates_GlobalFromLonLat( { lon, lat }, ( step % 13 ) * 1000.0 );
+
+    tm_vector3d direction( sin( step * 1.3 ), cos( step * 2.1 ), sin( step * 0.7 ) );
+    direction.Normalize();
+    const tm_vector3d up    = tmcoordinates_GetUpAt( origin );
+    const tm_vector3d moved = origin + direction * ( 0.999 * threshold * sqrt( up.x * up.x + up.y * up.y ) );
+
+    frame = tm_local_frame();
+    frame.SetThreshold( threshold );
+    frame.Update( origin );
+    frame.Update( moved );
+
+    frame.ToLocal( &vectors[0].x, &local[0].x, 3, 3, tm_local_frame_axes::ENU );
+    for( tm_uint32 k = 0; k < 3; ++k )
+    {
+      const tm_vector3d exact  = ToLocalExact( moved, vectors[k] );
+      const tm_vector3d single = frame.ToLocal( vectors[k], tm_local_frame_axes::ENU );
+      const tm_vector3d d      = single - exact;
+      const tm_vector3d b      = local[k] - single;
+      const double      norm   = sqrt( vectors[k].x * vectors[k].x + vectors[k].y * vectors[k].y + vectors[k].z * vectors[k].z );
+
+      max_error            = fmax( max_error, sqrt( d.x * d.x + d.y * d.y + d.z * d.z ) / norm );
+      max_batch_difference = fmax( max_batch_difference, sqrt( b.x * b.x + b.y * b.y + b.z * b.z ) / norm );
+    }
+  }
+
+  CheckResult( "local/relative_error_at_threshold", max_error, bound );
+  CheckResult( "local/batch_against_single", max_batch_difference, 1e-15 );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the fixed rate output: the cost of sampling a frame, what 1000 Hz frames sampled from jittery
+// 60 fps simulation frames look like against sending the latest frame again, and how well the
+// clock of the sender thread keeps the rate. the simulation runs on a virtual clock, the values
+// are sines with a known rate, the position of a rate linked pair gets its rate sent along.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static double OutputSignal( const tm_uint32 value, const double time )
+{
+  return value == 1 ? 2.0 * cos( 2.0 * time ) : sin( 2.0 * time + value );
+}
+
+static void BenchmarkOutput()
+{
+  tm_output_channel channels[tm_telemetry_max_channels];
+  channels[0].RateValue = 1;        // value 1 is the rate of value 0
+  channels[0].RateScale = 1.0;
+
+  tm_frame_interpolator interpolator;
+  interpolator.Configure( channels, tm_telemetry_max_channels, 0.1 );
+
+  tm_telemetry_frame frame, sampled;
+  tm_uint32          step = 0;
+  volatile double    sink = 0;
+
+  for( const tm_uint32 num_values : { 11u, 128u } )
+  {
+    for( tm_uint32 f = 0; f < 2; ++f )
+    {
+      frame.SimTime = f / 60.0;
+      frame.SetAllChannels( num_values );
+      for( tm_uint32 i = 0; i < num_values; ++i ) { frame.Values[i] = OutputSignal( i, frame.SimTime ); }
+      interpolator.Add( frame );
+    }
+
+    char name[64];
+    snprintf( name, sizeof( name ), "output/interpolate_%u_values", num_values );
+    RunBenchmark( name, 1000000, [&]() { sink = interpolator.Sample( ( ++step & 15 ) / 960.0, sampled ) + sampled.Values[0]; } );
+    snprintf( name, sizeof( name ), "output/extrapolate_%u_values", num_values );
+    RunBenchmark( name, 1000000, [&]() { sink = interpolator.Sample( 1 / 60.0 + ( ++step & 15 ) / 960.0, sampled ) + sampled.Values[0]; } );
+    interpolator.Reset();
+  }
+
+  // 60 fps with up to 4 ms of jitter when the frames are pushed, every 97th frame 30 ms late
+  tm_output_scheduler scheduler;
+  scheduler.Configure( channels, tm_telemetry_max_channels, -1, 0.1 );
+
+  const tm_uint32 num_values   = 4;
+  const tm_uint64 interval_ns  = 1000000;
+  const tm_uint64 start_ns     = 1000000000;
+  double          max_error[2] = {};    // the rate linked value, the others
+  double          max_step     = 0, max_step_hold = 0;
+  double          previous     = 0, previous_hold = 0;
+  tm_uint64       num_compared = 0;
+
+  tm_uint32 next_frame = 0;
+  for( tm_uint64 tick = start_ns; tick < start_ns + 20000 * interval_ns; tick += interval_ns )
+  {
+    for( ;; )
+    {
+      const double    sim_time = next_frame / 60.0;
+      const tm_uint64 jitter   = static_cast<tm_uint64>( ( next_frame * 0.6180339887 - floor( next_frame * 0.6180339887 ) ) * 4e6 );
+      const tm_uint64 pushed   = start_ns + static_cast<tm_uint64>( sim_time * 1e9 ) + jitter + ( next_frame % 97 == 96 ? 30000000 : 0 );
+      if( pushed > tick ) { break; }
+
+      frame.SimTime = sim_time;
+      frame.SetAllChannels( num_values );
+      for( tm_uint32 i = 0; i < num_values; ++i ) { frame.Values[i] = OutputSignal( i, sim_time ); }
+      scheduler.Push( frame, pushed );
+      ++next_frame;
+    }
+
+    if( !scheduler.Sample( tick, tick, sampled ) ) { continue; }
+
+    // the latest frame sent again, what a consumer polling at 1000 Hz gets without the scheduler
+    const double hold = frame.Values[0];
+    if( num_compared++ > 0 )
+    {
+      max_step      = fmax( max_step, fabs( sampled.Values[0] - previous ) );
+      max_step_hold = fmax( max_step_hold, fabs( hold - previous_hold ) );
+    }
+    previous      = sampled.Values[0];
+    previous_hold = hold;
+
+    for( tm_uint32 i = 0; i < num_values; ++i ) { max_error[i > 0] = fmax( max_error[i > 0], fabs( sampled.Values[i] - OutputSignal( i, sampled.SimTime ) ) ); }
+  }
+
+  const tm_output_stats &stats = scheduler.GetStats();
+  PrintResult( "output/max_step_latest_frame", max_step_hold * 1000, "1e-3" );
+  PrintResult( "output/max_step_scheduled", max_step * 1000, "1e-3" );
+  PrintResult( "output/extrapolated_frames", stats.Extrapolated, "frames" );
+  PrintResult( "output/extrapolation_depth_max", stats.ExtrapolationMax * 1000, "ms" );
+
+  // interpolating a * sin( 2 t ) at 60 fps is off by up to 4 a / 8 / 60^2. extrapolating a late
+  // frame by up to 30 ms with the exact rate adds 4 a * 0.03^2 / 2, with the rate between the last
+  // two frames, which is the one half a frame earlier, another 4 a * 0.03 / 120. a is at most 2.
+  CheckResult( "output/max_error_rate_linked", max_error[0], 2e-3 );
+  CheckResult( "output/max_error_frame_difference", max_error[1], 6e-3 );
+
+  // the real clock at 1000 Hz
+  const tm_uint32 num_ticks = 500;
+  tm_uint64       tick      = tm_output_get_time_ns();
+  const tm_uint64 first     = tick;
+  double          late_sum  = 0, late_max = 0;
+  for( tm_uint32 i = 0; i < num_ticks; ++i )
+  {
+    tick += interval_ns;
+    tm_output_sleep_until( tick );
+    const double late = ( tm_output_get_time_ns() - tick ) * 1e-3;
+    late_sum += late;
+    late_max  = fmax( late_max, late );
+  }
+
+  PrintResult( "output/clock_rate", num_ticks * 1e9 / static_cast<double>( tick - first ), "Hz" );
+  PrintResult( "output/clock_jitter_mean", late_sum / num_ticks, "us" );
+  PrintResult( "output/clock_jitter_max", late_max, "us" );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// cost of recording on the simulation thread, the writer thread appends to a file meanwhile
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkRecord()
+{
+  const char           *path = "aerofly_fs_2_external_dll_benchmark.afrl";
+  std::vector<tm_uint8> byte_stream;
+  tm_frame_recorder     recorder;
+
+  for( const tm_uint32 num_messages : { 10u, 100u, 450u } )
+  {
+    const tm_uint32 byte_stream_size = CreateMessageStream( num_messages, byte_stream );
+    char name[64];
+
+    snprintf( name, sizeof( name ), "record/disabled_%u", num_messages );
+    RunBenchmark( name, 200000, [&]()
+    {
+      if( recorder.IsRecording() ) { recorder.Record( std::chrono::steady_clock::now(), 1.0 / 60, byte_stream.data(), byte_stream_size, num_messages ); }
+    } );
+
+    // enough buffer that the writer thread keeps up on one core as well
+    recorder.Start( path, 64ull << 20 );
+    snprintf( name, sizeof( name ), "record/enabled_%u", num_messages );
+    RunBenchmark( name, 1000, [&]()
+    {
+      if( recorder.IsRecording() ) { recorder.Record( std::chrono::steady_clock::now(), 1.0 / 60, byte_stream.data(), byte_stream_size, num_messages ); }
+    } );
+    recorder.Stop();
+
+    if( recorder.GetDropped() > 0 ) { PrintResult( "record/dropped", static_cast<double>( recorder.GetDropped() ), "frames" ); }
+  }
+
+  remove( path );
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// commands of external tools: parsing on the listener thread, queueing and adding them to the
+// byte stream of Update. a burst of commands larger than the byte stream has to arrive in order
+// over the next updates.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkCommand()
+{
+  static const char line[] = "Controls.Throttle1 0.8";
+
+  tm_external_message message;
+  volatile tm_uint32  sink = 0;
+  RunBenchmark( "command/parse", 1000000, [&]() { sink = tm_command_parse( line, sizeof( line ) - 1, message ) == nullptr ? message.GetSize() : 0; } );
+
+  tm_command_listener listener;
+  tm_uint8            byte_stream[4096];
+  tm_uint32           byte_stream_size = 0;
+  tm_uint32           num_messages     = 0;
+  listener.Reset( 1024 );
+  RunBenchmark( "command/receive_add_to_byte_stream", 1000000, [&]()
+  {
+    listener.Receive( line, sizeof( line ) - 1 );
+    byte_stream_size = 0;
+    listener.AddToByteStream( byte_stream, byte_stream_size, num_messages, sizeof( byte_stream ) );
+  } );
+
+  // 1000 commands in one datagram against a byte stream with room for three
+  const tm_uint32 num_commands = 1000;
+  std::vector<char> burst;
+  for( tm_uint32 i = 0; i < num_commands; ++i )
+  {
+    char command[64];
+    const int length = snprintf( command, sizeof( command ), "Controls.Throttle1 %u\n", i );
+    burst.insert( burst.end(), command, command + length );
+  }
+
+  listener.Reset( 1024 );
+  listener.Receive( burst.data(), static_cast<tm_uint32>( burst.size() ) );
+  listener.Receive( "Aircraft.Pitch 1", 16 );
+
+  const tm_uint32 byte_stream_size_max = 3 * message.GetSize() + 8;
+  tm_uint32       updates              = 0;
+  tm_uint32       received             = 0;
+  double          out_of_order         = 0;
+  double          oversized            = 0;
+  for( tm_uint32 sent = 1; sent > 0; ++updates )
+  {
+    byte_stream_size = 0;
+    sent             = 0;
+    listener.AddToByteStream( byte_stream, byte_stream_size, sent, byte_stream_size_max );
+    oversized = byte_stream_size > byte_stream_size_max ? oversized + 1 : oversized;
+
+    for( tm_uint32 pos = 0, i = 0; i < sent; ++i, ++received )
+    {
+      const tm_external_message command = tm_external_message::GetFromByteStream( byte_stream, pos );
+      out_of_order += command.GetDouble() != received ? 1 : 0;
+    }
+  }
+
+  const tm_command_stats stats = listener.GetStats();
+  PrintResult( "command/burst_updates", updates - 1, "updates" );
+  CheckResult( "command/burst_lost", num_commands - received, 0 );
+  CheckResult( "command/burst_out_of_order", out_of_order, 0 );
+  CheckResult( "command/burst_oversized_streams", oversized, 0 );
+  CheckResult( "command/read_only_accepted", static_cast<double>( stats.Received - num_commands ), 0 );
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// shared memory against udp loopback for a consumer on the same machine: the time from handing a
+// frame to the transport until a waiting reader thread has decoded it, one frame every 0.5 ms.
+// a second reader copies frames while the writer overwrites the ring as fast as it can, none of
+// the frames it accepts may be torn.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintLatency( const char *name, std::vector<double> &latencies )
+{
+  if( latencies.empty() ) { return; }
+  std::sort( latencies.begin(), latencies.end() );
+
+  char result[64];
+  for( const double percentile : { 50.0, 99.0, 99.9 } )
+  {
+    snprintf( result, sizeof( result ), "%s_p%g", name, percentile );
+    PrintResult( result, latencies[static_cast<size_t>( percentile / 100 * ( latencies.size() - 1 ) )], "ns" );
+  }
+}
+
+static void BenchmarkSharedMemory()
+{
+  const char     *name       = "aerofly_fs_2_external_dll_benchmark";
+  const tm_uint32 num_frames = 4000;
+
+  tm_telemetry_frame frame = CreateBenchmarkFrame();
+  frame.SetAllChannels( 64 );
+
+  tm_telemetry_shm_writer writer;
+  if( !writer.Open( name, 64 ) )
+  {
+    printf( "shm: cannot create shared memory\n" );
+    return;
+  }
+
+  RunBenchmark( "shm/publish_64_values", 200000, [&]() { writer.Publish( frame ); } );
+
+  tm_telemetry_shm_reader reader;
+  tm_telemetry_frame      read;
+  reader.Open( name );
+  RunBenchmark( "shm/publish_read_latest", 200000, [&]() { writer.Publish( frame ); reader.ReadLatest( read ); } );
+  reader.Close();
+
+  // frame i carries the time it was handed over in value 0
+  const auto measure = [&]( const char *result_name, auto &&send, auto &&receive )
+  {
+    std::vector<double> latencies;
+    latencies.reserve( num_frames );
+    std::atomic<bool> done{ false };
+
+    std::thread consumer( [&]()
+    {
+      tm_telemetry_frame received;
+      while( latencies.size() < num_frames && !done.load( std::memory_order_acquire ) )
+      {
+        if( receive( received ) ) { latencies.push_back( static_cast<double>( tm_output_get_time_ns() ) - received.Values[0] ); }
+      }
+    } );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    for( tm_uint32 i = 0; i < num_frames; ++i )
+    {
+      frame.Sequence  = i;
+      frame.Values[0] = static_cast<double>( tm_output_get_time_ns() );
+      send( frame );
+      tm_output_sleep_until( tm_output_get_time_ns() + 500000 );
+    }
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    done.store( true, std::memory_order_release );
+    send( frame );
+    consumer.join();
+
+    PrintResult( ( std::string( result_name ) + "_received" ).c_str(), static_cast<double>( latencies.size() ), "frames" );
+    PrintLatency( result_name, latencies );
+  };
+
+  reader.Open( name );
+  measure( "shm/wait_latency", [&]( const tm_telemetry_frame &f ) { writer.Publish( f ); }, [&]( tm_telemetry_frame &f )
+  {
+    if( reader.ReadNext( f ) == tm_telemetry_shm_result::Frame ) { return true; }
+    reader.Wait( 100 );
+    return false;
+  } );
+  CheckResult( "shm/wait_skipped", static_cast<double>( reader.GetSkipped() ), 0 );
+  reader.Close();
+
+  tm_socket_startup();
+  const tm_socket socket_receive = socket( AF_INET, SOCK_DGRAM, 0 );
+  sockaddr_in     address        = {};
+  address.sin_family      = AF_INET;
+  address.sin_port        = htons( 4129 );
+  address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+  bind( socket_receive, reinterpret_cast<const sockaddr*>( &address ), sizeof( address ) );
+
+  tm_udp_sender sender;
+  sender.Open( "127.0.0.1", "4129" );
+  measure( "shm/udp_loopback_latency", [&]( const tm_telemetry_frame &f )
+  {
+    tm_uint8 datagram[tm_telemetry_max_datagram_size];
+    sender.Send( datagram, f.EncodeBinary( datagram, sizeof( datagram ), false ) );
+  }, [&]( tm_telemetry_frame &f )
+  {
+    tm_uint8   datagram[tm_telemetry_max_datagram_size];
+    const auto size = recv( socket_receive, reinterpret_cast<char*>( datagram ), sizeof( datagram ), 0 );
+    return size > 0 && f.DecodeBinary( datagram, static_cast<tm_uint32>( size ) );
+  } );
+  sender.Close();
+  tm_socket_close( socket_receive );
+  tm_socket_cleanup();
+
+  // every value of frame n is n, a torn copy mixes two frames
+  std::atomic<bool> writing{ true };
+  double            torn     = 0;
+  double            accepted = 0;
+  for( tm_uint32 i = 0; i < 64; ++i ) { frame.Values[i] = 0; }
+  writer.Publish( frame );     // the latest frame of the latency runs carries a time in value 0
+  reader.Open( name );
+  std::thread checker( [&]()
+  {
+    tm_telemetry_frame received;
+    while( writing.load( std::memory_order_acquire ) )
+    {
+      if( reader.ReadNext( received ) != tm_telemetry_shm_result::Frame ) { continue; }
+      ++accepted;
+      for( tm_uint32 i = 1; i < 64; ++i ) { torn += received.Values[i] != received.Values[0] ? 1 : 0; }
+    }
+  } );
+
+  for( tm_uint32 n = 0; n < 2000000; ++n )
+  {
+    for( tm_uint32 i = 0; i < 64; ++i ) { frame.Values[i] = n; }
+    writer.Publish( frame );
+  }
+  writing.store( false, std::memory_order_release );
+  checker.join();
+
+  PrintResult( "shm/overwrite_accepted", accepted, "frames" );
+  PrintResult( "shm/overwrite_skipped", static_cast<double>( reader.GetSkipped() ), "frames" );
+  CheckResult( "shm/overwrite_torn", torn, 0 );
+
+  reader.Close();
+  writer.Close();
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// per-stage probes: what a lap costs with the stats off and on, and how far the percentiles of
+// the histogram are from the exact ones of the same durations
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkStage()
+{
+  tm_stage_stats     stats;
+  volatile tm_uint64 sink = 0;
+
+  RunBenchmark( "stage/lap_disabled", 10000000, [&]()
+  {
+    const tm_uint64 probe = stats.Begin();
+    sink = stats.Lap( tm_stage::Decode, probe );
+  } );
+
+  // an interval that never comes, the publisher thread only naps
+  stats.Start( 1e6, nullptr, nullptr, nullptr );
+  RunBenchmark( "stage/lap_enabled", 1000000, [&]()
+  {
+    const tm_uint64 probe = stats.Begin();
+    sink = stats.Lap( tm_stage::Decode, probe );
+  } );
+  stats.Stop();
+
+  tm_latency_snapshot snapshot;
+  stats.GetSnapshot( tm_stage::Decode, snapshot );
+  PrintResult( "stage/lap_enabled_p50", snapshot.GetPercentile( 50 ), "ns" );
+
+  // log-uniform durations from 10 ns to 100 ms, the range the stages actually span
+  tm_latency_histogram   histogram;
+  std::vector<tm_uint64> durations( 200000 );
+  srand( 19 );
+  for( auto &duration : durations )
+  {
+    duration = static_cast<tm_uint64>( pow( 10.0, 1.0 + 7.0 * rand() / RAND_MAX ) );
+    histogram.Record( duration );
+  }
+
+  tm_uint32 step = 0;
+  RunBenchmark( "stage/histogram_record", 10000000, [&]() { histogram.Record( durations[++step % durations.size()] ); } );
+
+  histogram.Reset();
+  for( const tm_uint64 duration : durations ) { histogram.Record( duration ); }
+  histogram.Snapshot( snapshot );
+  std::sort( durations.begin(), durations.end() );
+
+  double deviation = 0;
+  for( const double percentile : { 1.0, 50.0, 90.0, 99.0, 99.9, 99.99, 100.0 } )
+  {
+    const tm_uint64 rank  = static_cast<tm_uint64>( percentile / 100 * static_cast<double>( durations.size() - 1 ) ) + 1;
+    const double    exact = static_cast<double>( durations[rank - 1] );
+    deviation = std::max( deviation, fabs( snapshot.GetPercentile( percentile ) - exact ) / exact );
+  }
+
+  // half a bucket of 32 per power of two
+  CheckResult( "stage/percentile_relative_error", deviation, 1.0 / 64 );
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// frame pacing: the cost of recording delta_time every Update, and a minute of 60 Hz frames with
+// jitter, pauses and known stalls that all have to be found and marked on the wire
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkPacing()
+{
+  tm_frame_pacing_monitor monitor;
+  monitor.Reset( 0.05 );
+
+  tm_uint32         step = 0;
+  volatile tm_uint64 sink = 0;
+  RunBenchmark( "pacing/update", 10000000, [&]() { sink = monitor.Update( 1.0 / 60 + ( ++step & 15 ) * 1e-5 ); } );
+
+  monitor.Reset( 0.05 );
+  srand( 20 );
+  tm_uint32 injected = 0;
+  tm_uint32 paused   = 0;
+  tm_uint32 detected = 0;
+  tm_uint32 flagged  = 0;
+  double    longest  = 0;
+
+  tm_telemetry_frame_state state;
+  tm_telemetry_frame       frame;
+  tm_uint8                 datagram[tm_telemetry_max_datagram_size];
+  frame.SetAllChannels( 16 );
+
+  for( tm_uint32 n = 0; n < 3600; ++n )
+  {
+    double delta_time = 1.0 / 60 * ( 0.9 + 0.2 * rand() / RAND_MAX );
+    if( n % 500 == 250 )
+    {
+      delta_time = 0;
+      ++paused;
+    }
+    else if( n % 300 == 150 )
+    {
+      delta_time = 0.06 + 0.01 * ( n / 300 );
+      longest    = delta_time;
+      ++injected;
+    }
+
+    const bool stall = monitor.Update( delta_time );
+    detected += stall ? 1 : 0;
+
+    // through the binary format the way the sender sends it
+    frame.Sequence = n;
+    frame.Flags    = stall ? static_cast<tm_uint16>( tm_telemetry_frame_flag::Stall ) : 0;
+    const tm_uint32 size = frame.EncodeBinary( datagram, sizeof( datagram ), false );
+    if( state.Apply( datagram, size ) && ( state.GetFrame().Flags & static_cast<tm_uint16>( tm_telemetry_frame_flag::Stall ) ) != 0 ) { ++flagged; }
+  }
+
+  const tm_frame_pacing_stats &stats = monitor.GetStats();
+  PrintResult( "pacing/rolling_p50", monitor.GetRolling().P50 * 1e3, "ms" );
+  PrintResult( "pacing/rolling_p99", monitor.GetRolling().P99 * 1e3, "ms" );
+  CheckResult( "pacing/stalls_missed", fabs( static_cast<double>( detected ) - injected ), 0 );
+  CheckResult( "pacing/stalls_not_flagged", fabs( static_cast<double>( flagged ) - injected ), 0 );
+  CheckResult( "pacing/paused_miscounted", fabs( static_cast<double>( stats.Paused ) - paused ), 0 );
+  CheckResult( "pacing/longest_stall_error", fabs( stats.LongestStall - longest ), 1e-12 );
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// batch math: every kernel of every instruction set this machine has, against the scalar
+// templates of tm_external_message.h. the sample count is not a multiple of the vector width so
+// the tails are covered as well.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+struct tm_batch_arrays
+{
+  std::vector<double> Data;
+  tm_uint32           Count;
+
+  tm_batch_arrays( const tm_uint32 components, const tm_uint32 count ) : Data( components * count ), Count( count ) { }
+  double *operator[]( const tm_uint32 component ) { return Data.data() + component * Count; }
+  tm_vector3d_soa    Vector()     { return { ( *this )[0], ( *this )[1], ( *this )[2] }; }
+  tm_quaterniond_soa Quaternion() { return { ( *this )[0], ( *this )[1], ( *this )[2], ( *this )[3] }; }
+  tm_matrix3d_soa    Matrix()     { return { ( *this )[0], ( *this )[1], ( *this )[2], ( *this )[3], ( *this )[4], ( *this )[5], ( *this )[6], ( *this )[7], ( *this )[8] }; }
+};
+
+// the largest relative deviation and how many values are not bit for bit the same
+static void CompareBatch( const char *name, tm_batch_arrays &result, tm_batch_arrays &reference )
+{
+  double deviation = 0;
+  double differing = 0;
+  for( size_t i = 0; i < result.Data.size(); ++i )
+  {
+    const double a = result.Data[i], b = reference.Data[i];
+    differing += memcmp( &a, &b, sizeof( double ) ) != 0 ? 1 : 0;
+    deviation  = std::max( deviation, fabs( a - b ) / std::max( fabs( b ), 1e-300 ) );
+  }
+
+  char text[64];
+  snprintf( text, sizeof( text ), "%s_differing", name );
+  PrintResult( text, differing, "values" );
+  snprintf( text, sizeof( text ), "%s_deviation", name );
+  CheckResult( text, deviation, 1e-15 );
+}
+
+static void BenchmarkBatch()
+{
+  const tm_uint32 n = 4099;
+  tm_batch_arrays quaternions( 4, n ), vectors( 3, n );
+
+  // unit quaternions of all orientations and vectors of all lengths and directions
+  for( tm_uint32 i = 0; i < n; ++i )
+  {
+    tm_quaterniond q( sin( i * 0.37 ), cos( i * 1.1 ), sin( i * 2.3 ), cos( i * 0.7 ) );
+    const double   length = sqrt( q.r * q.r + q.x * q.x + q.y * q.y + q.z * q.z );
+    quaternions[0][i] = q.r / length;
+    quaternions[1][i] = q.x / length;
+    quaternions[2][i] = q.y / length;
+    quaternions[3][i] = q.z / length;
+    vectors[0][i]     = 100 * sin( i * 0.13 );
+    vectors[1][i]     = 0.01 * cos( i * 0.29 ) + 1e-3;
+    vectors[2][i]     = -9.81 + i % 7;
+  }
+
+  const tm_matrix3d uniform = tm_QuaternionToMatrix( tm_quaterniond( 0.9, 0.1, -0.3, 0.2 ) );
+
+  tm_batch_arrays reference_matrices( 9, n ), reference_rotated( 3, n ), reference_uniform( 3, n ), reference_normalized( 3, n );
+  const tm_batch_kernels scalar = tm_batch_get_kernels( tm_batch_isa::Scalar );
+  scalar.QuaternionToMatrix( quaternions.Quaternion(), reference_matrices.Matrix(), n );
+  scalar.Rotate( reference_matrices.Matrix(), vectors.Vector(), reference_rotated.Vector(), n );
+  scalar.RotateUniform( uniform, vectors.Vector(), reference_uniform.Vector(), n );
+  scalar.Normalize( vectors.Vector(), reference_normalized.Vector(), n );
+
+  PrintResult( "batch/samples", n, "per call" );
+  for( const tm_batch_isa isa : { tm_batch_isa::Scalar, tm_batch_isa::SSE2, tm_batch_isa::AVX2 } )
+  {
+    const tm_batch_kernels kernels = tm_batch_get_kernels( isa );
+    if( kernels.Isa != isa ) { continue; }
+
+    const char     *suffix = tm_batch_isa_names[static_cast<tm_uint32>( isa )];
+    tm_batch_arrays matrices( 9, n ), rotated( 3, n ), uniform_rotated( 3, n ), normalized( 3, n );
+    char            name[64];
+
+    snprintf( name, sizeof( name ), "batch/quaternion_to_matrix_%s", suffix );
+    RunBenchmark( name, 2000, [&]() { kernels.QuaternionToMatrix( quaternions.Quaternion(), matrices.Matrix(), n ); } );
+    CompareBatch( name, matrices, reference_matrices );
+
+    snprintf( name, sizeof( name ), "batch/rotate_%s", suffix );
+    RunBenchmark( name, 2000, [&]() { kernels.Rotate( reference_matrices.Matrix(), vectors.Vector(), rotated.Vector(), n ); } );
+    CompareBatch( name, rotated, reference_rotated );
+
+    snprintf( name, sizeof( name ), "batch/rotate_uniform_%s", suffix );
+    RunBenchmark( name, 2000, [&]() { kernels.RotateUniform( uniform, vectors.Vector(), uniform_rotated.Vector(), n ); } );
+    CompareBatch( name, uniform_rotated, reference_uniform );
+
+    snprintf( name, sizeof( name ), "batch/normalize_%s", suffix );
+    RunBenchmark( name, 2000, [&]() { kernels.Normalize( vectors.Vector(), normalized.Vector(), n ); } );
+    CompareBatch( name, normalized, reference_normalized );
+  }
+
+  // the templates themselves on an array of structures, what callers do without the kernels
+  std::vector<tm_quaterniond> aos_quaternions( n );
+  std::vector<tm_matrix3d>    aos_matrices( n );
+  for( tm_uint32 i = 0; i < n; ++i ) { aos_quaternions[i] = tm_quaterniond( quaternions[0][i], quaternions[1][i], quaternions[2][i], quaternions[3][i] ); }
+  RunBenchmark( "batch/quaternion_to_matrix_aos", 2000, [&]()
+  {
+    for( tm_uint32 i = 0; i < n; ++i ) { aos_matrices[i] = tm_QuaternionToMatrix( aos_quaternions[i] ); }
+  } );
+
+  PrintResult( "batch/selected", static_cast<double>( tm_batch_get_kernels().Isa ), tm_batch_isa_names[static_cast<tm_uint32>( tm_batch_get_kernels().Isa )] );
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// state table: updating it from the byte stream and extracting the subscribed channels out of it,
+// against extracting them from the messages. a frame with only a few messages has to keep the
+// values of all others.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkState()
+{
+  std::vector<tm_uint8> byte_stream;
+  tm_telemetry_frame    frame;
+  tm_state_table        state;
+  volatile double       sink = 0;
+
+  tm_channel_plan full_plan;
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    tm_channel_subscription subscription;
+    subscription.Index = static_cast<tm_message_index>( i );
+    if( tm_message_catalog[i].DataType == tm_msg_data_type::Double ) { full_plan.Add( subscription ); }
+  }
+
+  PrintResult( "state/table_size", sizeof( tm_state_table ), "bytes" );
+
+  for( const tm_uint32 num_messages : { 10u, 100u, 450u } )
+  {
+    const tm_uint32 byte_stream_size = CreateMessageStream( num_messages, byte_stream );
+    char name[64];
+
+    snprintf( name, sizeof( name ), "state/update_%u", num_messages );
+    RunBenchmark( name, 2000000 / num_messages, [&]()
+    {
+      state.BeginFrame( 1.0 );
+      state.Update( tm_external_message_stream( byte_stream.data(), byte_stream_size, num_messages ) );
+      sink = state.GetDouble( tm_message_index::AircraftPitch );
+    } );
+
+    snprintf( name, sizeof( name ), "state/update_extract_%u_values_%u", full_plan.GetNumValues(), num_messages );
+    RunBenchmark( name, 2000000 / num_messages, [&]()
+    {
+      state.BeginFrame( 1.0 );
+      state.Update( tm_external_message_stream( byte_stream.data(), byte_stream_size, num_messages ) );
+      full_plan.Extract( state, frame );
+      sink = frame.Values[0];
+    } );
+  }
+
+  // every message once, then a frame with only 10 of them
+  std::vector<tm_uint8> all_stream, few_stream;
+  const tm_uint32       all_size = CreateMessageStream( tm_message_count, all_stream );
+  const tm_uint32       few_size = CreateMessageStream( 10, few_stream );
+  tm_telemetry_frame    expected;
+
+  state.Reset();
+  state.BeginFrame( 1.0 );
+  state.Update( tm_external_message_stream( all_stream.data(), all_size, tm_message_count ) );
+  state.BeginFrame( 1.0 + 1.0 / 60 );
+  state.Update( tm_external_message_stream( few_stream.data(), few_size, 10 ) );
+  full_plan.Extract( state, frame );
+
+  // the per-message extraction of both frames into the same values
+  full_plan.BeginFrame( expected );
+  for( const auto message : tm_external_message_stream( all_stream.data(), all_size, tm_message_count ) ) { full_plan.Extract( message, expected ); }
+  for( const auto message : tm_external_message_stream( few_stream.data(), few_size, 10 ) )              { full_plan.Extract( message, expected ); }
+
+  double deviation = 0;
+  for( tm_uint32 i = 0; i < full_plan.GetNumValues(); ++i ) { deviation = std::max( deviation, fabs( frame.Values[i] - expected.Values[i] ) ); }
+  CheckResult( "state/stale_values_kept", deviation, 0 );
+
+  double dirty = 0, wrong_age = 0;
+  state.ForEachDirty( [&]( const tm_message_index ) { ++dirty; } );
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    // a few names appear twice in MESSAGE_LIST, the id always finds the first entry
+    const tm_message_index index = static_cast<tm_message_index>( i );
+    if( tm_message_lookup( tm_message_ids[i] ) != index ) { continue; }
+
+    const double age = state.IsDirty( index ) ? 0 : 1.0 / 60;
+    wrong_age += fabs( state.GetAge( index ) - age ) > 1e-12 ? 1 : 0;
+  }
+  CheckResult( "state/dirty_miscounted", fabs( dirty - 10 ), 0 );
+  CheckResult( "state/wrong_age", wrong_age, 0 );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// state snapshots: what publishing the state table costs the simulation thread once per frame,
+// without a reader, alone and while a reader takes every snapshot on another thread, and whether
+// a reader ever sees a torn or an older snapshot
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void BenchmarkSnapshot()
+{
+  std::vector<tm_uint8> byte_stream;
+  const tm_uint32       byte_stream_size = CreateMessageStream( tm_message_count, byte_stream );
+  volatile double       sink = 0;
+
+  auto state    = std::make_unique<tm_state_table>();
+  auto snapshot = std::make_unique<tm_triple_buffer<tm_state_table>>();
+  state->BeginFrame( 1.0 );
+  state->Update( tm_external_message_stream( byte_stream.data(), byte_stream_size, tm_message_count ) );
+
+  // a writer that checks for a reader first
+  const auto publish = [&]() { if( snapshot->HasReader() ) { snapshot->Publish( *state ); } };
+  RunBenchmark( "snapshot/publish_without_reader", 2000000, publish );
+  CheckResult( "snapshot/published_without_reader", static_cast<double>( snapshot->GetPublished() ), 0 );
+
+  snapshot->Attach();
+  RunBenchmark( "snapshot/publish_state_table", 200000, publish );
+  RunBenchmark( "snapshot/publish_in_place", 2000000, [&]() { snapshot->Publish(); } );
+  RunBenchmark( "snapshot/publish_read", 200000, [&]()
+  {
+    snapshot->Publish( *state );
+    snapshot->Update();
+    sink = snapshot->Read().GetDouble( tm_message_index::AircraftPitch );
+  } );
+
+  std::atomic<bool> reading{ true };
+  double            taken = 0;
+  std::thread reader( [&]()
+  {
+    while( reading.load( std::memory_order_acquire ) )
+    {
+      if( snapshot->Update() ) { ++taken; sink = snapshot->Read().GetDouble( tm_message_index::AircraftPitch ); }
+    }
+  } );
+  RunBenchmark( "snapshot/publish_state_table_while_read", 200000, [&]() { snapshot->Publish( *state ); } );
+  reading.store( false, std::memory_order_release );
+  reader.join();
+  PrintResult( "snapshot/taken_while_read", taken, "snapshots" );
+
+  // every word of snapshot n is n, a torn snapshot mixes two of them
+  struct tm_words { tm_uint64 Words[sizeof( tm_state_table ) / sizeof( tm_uint64 )]; };
+  auto              words      = std::make_unique<tm_triple_buffer<tm_words>>();
+  const tm_uint64   num_frames = 200000;
+  std::atomic<bool> writing{ true };
+  double            torn = 0, backwards = 0, read = 0;
+  tm_uint64         last = 0;
+
+  std::thread checker( [&]()
+  {
+    for( bool running = true; running; )
+    {
+      running = writing.load( std::memory_order_acquire );
+      if( !words->Update() ) { continue; }
+
+      const tm_words &received = words->Read();
+      ++read;
+      backwards += received.Words[0] < last ? 1 : 0;
+      last       = received.Words[0];
+      for( const tm_uint64 word : received.Words ) { torn += word != received.Words[0] ? 1 : 0; }
+    }
+  } );
+
+  for( tm_uint64 n = 1; n <= num_frames; ++n )
+  {
+    tm_words &back = words->GetBack();
+    for( tm_uint64 &word : back.Words ) { word = n; }
+    words->Publish();
+  }
+  writing.store( false, std::memory_order_release );
+  checker.join();
+
+  PrintResult( "snapshot/overwrite_read", read, "snapshots" );
+  CheckResult( "snapshot/overwrite_torn", torn, 0 );
+  CheckResult( "snapshot/overwrite_backwards", backwards, 0 );
+  CheckResult( "snapshot/latest_missed", static_cast<double>( num_frames - last ), 0 );
+
+  (void)sink;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// string messages: decoding every one into a tm_string each frame against the tracker, which only
+// compares the raw payloads while nothing changes, and whether its ids and events are right
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void AppendStringMessage( std::vector<tm_uint8> &byte_stream, const tm_message_index index, const tm_msg_data_type data_type, const void *data, const tm_uint32 data_size )
+{
+  tm_msg_header header( tm_message_ids[static_cast<tm_uint32>( index )], data_type, tm_msg_flag::Value, tm_msg_access::Read, tm_msg_unit::None );
+  header.MessageSize = static_cast<tm_uint16>( sizeof( tm_msg_header ) + tm_string_max_length );
+
+  const size_t pos = byte_stream.size();
+  byte_stream.resize( pos + header.MessageSize, 0 );
+  memcpy( &byte_stream[pos], &header, sizeof( header ) );
+  memcpy( &byte_stream[pos + sizeof( header )], data, data_size < tm_string_max_length ? data_size : tm_string_max_length );
+}
+
+static void BenchmarkStrings()
+{
+  volatile tm_uint32 sink = 0;
+
+  // every String8 message of the catalog with its name, a frame where one of them changes and
+  // the second one changed alone
+  std::vector<tm_uint8> same, changed, second;
+  tm_uint32             num_messages = 0;
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    if( tm_message_catalog[i].DataType != tm_msg_data_type::String8 ) { continue; }
+
+    const char *name = tm_message_id_names[i];
+    AppendStringMessage( same, static_cast<tm_message_index>( i ), tm_msg_data_type::String8, name, static_cast<tm_uint32>( strlen( name ) ) );
+    AppendStringMessage( changed, static_cast<tm_message_index>( i ), tm_msg_data_type::String8, num_messages == 0 ? "changed" : name, static_cast<tm_uint32>( strlen( num_messages == 0 ? "changed" : name ) ) );
+    if( num_messages == 1 ) { AppendStringMessage( second, static_cast<tm_message_index>( i ), tm_msg_data_type::String8, "second", 6 ); }
+    ++num_messages;
+  }
+
+  const tm_external_message_stream same_stream( same.data(), static_cast<tm_uint32>( same.size() ), num_messages );
+  const tm_external_message_stream changed_stream( changed.data(), static_cast<tm_uint32>( changed.size() ), num_messages );
+  const tm_external_message_stream second_stream( second.data(), static_cast<tm_uint32>( second.size() ), 1 );
+  char name[64];
+
+  snprintf( name, sizeof( name ), "string/get_string_%u", num_messages );
+  RunBenchmark( name, 200000, [&]()
+  {
+    tm_uint32 first_chars = 0;
+    for( const auto message : same_stream ) { first_chars += static_cast<tm_uint8>( message.GetString().c_str()[0] ); }
+    sink = first_chars;
+  } );
+
+  tm_string_tracker tracker;
+  tracker.Reset( 64, 4096 );
+
+  snprintf( name, sizeof( name ), "string/tracker_unchanged_%u", num_messages );
+  RunBenchmark( name, 200000, [&]()
+  {
+    tracker.BeginFrame();
+    tracker.Update( same_stream );
+    sink = tracker.GetNumEvents();
+  } );
+
+  tm_uint64 frame = 0;
+  snprintf( name, sizeof( name ), "string/tracker_one_changed_%u", num_messages );
+  RunBenchmark( name, 200000, [&]()
+  {
+    tracker.BeginFrame();
+    tracker.Update( ( frame++ & 1 ) != 0 ? changed_stream : same_stream );
+    sink = tracker.GetNumEvents();
+  } );
+
+  // the text of every message as tm_string decodes it, then the same frame again
+  tracker.Reset( 64, 4096 );
+  tracker.BeginFrame();
+  tracker.Update( same_stream );
+
+  double wrong_text = 0;
+  for( const auto message : same_stream )
+  {
+    const tm_string expected = message.GetString();
+    wrong_text += tracker.GetString( tm_message_lookup( message.GetID() ) ) != std::string_view( expected.c_str() ) ? 1 : 0;
+  }
+  CheckResult( "string/wrong_text", wrong_text, 0 );
+  CheckResult( "string/first_frame_events_missing", fabs( static_cast<double>( tracker.GetNumEvents() ) - num_messages ), 0 );
+
+  tracker.BeginFrame();
+  tracker.Update( same_stream );
+  CheckResult( "string/unchanged_events", tracker.GetNumEvents(), 0 );
+
+  // one change, and one that leads back within a frame
+  const tm_message_index first    = tm_message_lookup( tm_external_message_view( changed.data() ).GetID() );
+  const tm_uint32        first_id = tracker.GetID( first );
+  tracker.BeginFrame();
+  tracker.Update( changed_stream );
+  const bool one_event = tracker.GetNumEvents() == 1 && tracker.GetEvents()[0].Index == first && tracker.GetEvents()[0].Previous == first_id &&
+                         tracker.GetString( first ) == "changed";
+  CheckResult( "string/change_event_wrong", one_event ? 0 : 1, 0 );
+
+  tracker.BeginFrame();
+  tracker.Update( same_stream );
+  tracker.Update( changed_stream );
+  tracker.Update( same_stream );
+  const bool coalesced = tracker.GetNumEvents() == 1 && tracker.GetEvents()[0].Current == first_id;
+  CheckResult( "string/coalesced_event_wrong", coalesced ? 0 : 1, 0 );
+
+  // two changes that both lead back within a frame, the first one goes while the second is queued
+  tracker.BeginFrame();
+  tracker.Update( changed_stream );
+  tracker.Update( second_stream );
+  const bool two_events = tracker.GetNumEvents() == 2;
+  tracker.Update( same_stream );
+  CheckResult( "string/round_trip_events", two_events ? tracker.GetNumEvents() : 1, 0 );
+
+  // equal text in another message and as UTF-16 is the same id, characters above 255 become '?'
+  std::vector<tm_uint8> wide;
+  const tm_chartype     aircraft_name[] = { 'c', '1', '7', '2' };
+  const tm_chartype     unicode_name[]  = { 'c', 0x2172, '7', '2' };
+  const tm_uint8        padded_name[]   = { 'c', '1', '7', '2', 0, 'x' };
+  AppendStringMessage( wide, tm_message_index::AircraftName, tm_msg_data_type::String, aircraft_name, sizeof( aircraft_name ) );
+  AppendStringMessage( wide, tm_message_index::AircraftNearestAirport, tm_msg_data_type::String8, "c172", 4 );
+  AppendStringMessage( wide, tm_message_index::AutopilotActiveLateralMode, tm_msg_data_type::String, unicode_name, sizeof( unicode_name ) );
+  AppendStringMessage( wide, tm_message_index::AutopilotArmedLateralMode, tm_msg_data_type::String8, padded_name, sizeof( padded_name ) );
+  tracker.BeginFrame();
+  tracker.Update( tm_external_message_stream( wide.data(), static_cast<tm_uint32>( wide.size() ), 4 ) );
+
+  const bool interned = tracker.GetID( tm_message_index::AircraftName ) == tracker.GetID( tm_message_index::AircraftNearestAirport ) &&
+                        tracker.GetID( tm_message_index::AircraftName ) == tracker.GetID( tm_message_index::AutopilotArmedLateralMode ) &&
+                        tracker.GetString( tm_message_index::AircraftName ) == "c172" &&
+                        tracker.GetString( tm_message_index::AutopilotActiveLateralMode ) == "c?72";
+  CheckResult( "string/interning_wrong", interned ? 0 : 1, 0 );
+
+  // a full pool hands out the empty string and counts it
+  tm_string_pool pool;
+  pool.Reset( 2, 64 );
+  const bool full = pool.Intern( "a" ) == 1 && pool.Intern( "b" ) == 2 && pool.Intern( "c" ) == 0 && pool.Intern( "a" ) == 1 && pool.GetOverflows() == 1;
+  CheckResult( "string/full_pool_wrong", full ? 0 : 1, 0 );
+
+  PrintResult( "string/pool_bytes", tracker.GetPool().GetCharsUsed(), "bytes" );
+  (void)sink;
+}
+
+
+
+
+int main( int argc, char *argv[] )
+{
+  const char *filter = "";
+  for( int i = 1; i < argc; ++i )
+  {
+    if( strcmp( argv[i], "--csv" ) == 0 ) { BenchmarkCSV = true; }
+    else                                   { filter = argv[i]; }
+  }
+
+  if( BenchmarkCSV ) { printf( "name,value,unit\n" ); }
+
+  if( strstr( "send", filter ) != nullptr || filter[0] == 0 )   { BenchmarkSend(); }
+  if( strstr( "format", filter ) != nullptr || filter[0] == 0 ) { BenchmarkFormat(); }
+  if( strstr( "delta", filter ) != nullptr || filter[0] == 0 )  { BenchmarkDelta(); }
+  if( strstr( "queue", filter ) != nullptr || filter[0] == 0 )  { BenchmarkQueue(); }
+  if( strstr( "dispatch", filter ) != nullptr || filter[0] == 0 ) { BenchmarkDispatch(); }
+  if( strstr( "message", filter ) != nullptr || filter[0] == 0 )  { BenchmarkMessages(); }
+  if( strstr( "receive", filter ) != nullptr || filter[0] == 0 )  { BenchmarkReceive(); }
+  if( strstr( "plan", filter ) != nullptr || filter[0] == 0 )     { BenchmarkPlan(); }
+  if( strstr( "washout", filter ) != nullptr || filter[0] == 0 )  { BenchmarkWashout(); }
+  if( strstr( "local", filter ) != nullptr || filter[0] == 0 )    { BenchmarkLocalFrame(); }
+  if( strstr( "output", filter ) != nullptr || filter[0] == 0 )   { BenchmarkOutput(); }
+  if( strstr( "record", filter ) != nullptr || filter[0] == 0 )   { BenchmarkRecord(); }
+  if( strstr( "command", filter ) != nullptr || filter[0] == 0 )  { BenchmarkCommand(); }
+  if( strstr( "shm", filter ) != nullptr || filter[0] == 0 )      { BenchmarkSharedMemory(); }
+  if( strstr( "stage", filter ) != nullptr || filter[0] == 0 )    { BenchmarkStage(); }
+  if( strstr( "pacing", filter ) != nullptr || filter[0] == 0 )   { BenchmarkPacing(); }
+  if( strstr( "batch", filter ) != nullptr || filter[0] == 0 )    { BenchmarkBatch(); }
+  if( strstr( "state", filter ) != nullptr || filter[0] == 0 )    { BenchmarkState(); }
+  if( strstr( "snapshot", filter ) != nullptr || filter[0] == 0 ) { BenchmarkSnapshot(); }
+  if( strstr( "string", filter ) != nullptr || filter[0] == 0 )   { BenchmarkStrings(); }
+
+  return BenchmarkFailed ? 1 : 0;
+}
@@ -0,0 +1,566 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file aerofly_fs_2_external_dll_replay.cpp
+//
+// loads an external dll and drives it like Aerofly FS 2 does, with the byte streams of a frame
+// log written by the telemetry dll or with synthetic frames built from MESSAGE_LIST
+//
+//   replay <dll> <recording.afrl | synthetic:<num_messages>> [options]
+//
+//     --speed <realtime | N | max>   pace of the frames, N times real time, default realtime
+//     --start <seconds>              skip the first seconds of the recording through its index
+//     --frames <count>               stop after this many frames
+//     --loop <count>                 play the frames this many times
+//     --check-specific-force         compares the specific force derived from Aircraft.Velocity
+//                                    with the samples of Aircraft.Acceleration before playing
+//     --check-allocations            counts the heap allocations inside Update after the first
+//                                    second of frames and fails if there are any
+//
+// At the end the frames per second and the percentiles of the time spent in Update are printed.
+//
+// The allocations are counted by replacing the global operator new of this program, which the
+// dll uses as well where the dynamic linker resolves it across modules, as on Linux. A dll on
+// Windows links its own operator new and is not counted.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "../shared/input/tm_external_message.h"
+#include "../shared/telemetry/tm_frame_log.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_external_message_view.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_message_catalog.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_platform.h"
+#include "../project_aerofly_fs_2_external_dll_sample/tm_specific_force.h"
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <math.h>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the dll interface, the same functions Aerofly FS 2 looks up
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+using tm_dll_get_interface_version = int  (*)();
+using tm_dll_init                  = bool (*)( const HINSTANCE );
+using tm_dll_shutdown              = void (*)();
+using tm_dll_update                = void (*)( const tm_double, const tm_uint8 * const, const tm_uint32, const tm_uint32,
+                                               tm_uint8 *, tm_uint32 &, tm_uint32 &, const tm_uint32 );
+
+struct tm_external_dll
+{
+  HINSTANCE                    Module              = nullptr;
+  tm_dll_get_interface_version GetInterfaceVersion = nullptr;
+  tm_dll_init                  Init                = nullptr;
+  tm_dll_shutdown              Shutdown            = nullptr;
+  tm_dll_update                Update              = nullptr;
+
+  static void *GetFunction( const HINSTANCE module, const char *name )
+  {
+#if TM_PLATFORM_WINDOWS
+    return reinterpret_cast<void*>( GetProcAddress( module, name ) );
+#else
+    return dlsym( module, name );
+#endif
+  }
+
+  bool Load( const char *path )
+  {
+#if TM_PLATFORM_WINDOWS
+    Module = LoadLibraryA( path );
+#else
+    Module = dlopen( path, RTLD_NOW | RTLD_LOCAL );
+#endif
+    if( Module == nullptr ) { return false; }
+
+    GetInterfaceVersion = reinterpret_cast<tm_dll_get_interface_version>( GetFunction( Module, "Aerofly_FS_2_External_DLL_GetInterfaceVersion" ) );
+    Init                = reinterpret_cast<tm_dll_init>( GetFunction( Module, "Aerofly_FS_2_External_DLL_Init" ) );
+    Shutdown            = reinterpret_cast<tm_dll_shutdown>( GetFunction( Module, "Aerofly_FS_2_External_DLL_Shutdown" ) );
+    Update              = reinterpret_cast<tm_dll_update>( GetFunction( Module, "Aerofly_FS_2_External_DLL_Update" ) );
+    return GetInterfaceVersion != nullptr && Init != nullptr && Shutdown != nullptr && Update != nullptr;
+  }
+
+  void Unload()
+  {
+    if( Module == nullptr ) { return; }
+#if TM_PLATFORM_WINDOWS
+    FreeLibrary( Module );
+#else
+    dlclose( Module );
+#endif
+    Module = nullptr;
+  }
+};
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// counting allocator. only the thread that calls Update counts, and only while it is in Update.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static thread_local bool global_count_allocations = false;
+static tm_uint64         global_allocations       = 0;
+static tm_uint64         global_allocation_size   = 0;       // of the first counted one
+
+static void *tm_replay_allocate( const size_t size, const size_t alignment )
+{
+  if( global_count_allocations )
+  {
+    if( global_allocations++ == 0 ) { global_allocation_size = size; }
+  }
+
+  const size_t rounded = ( size + alignment - 1 ) / alignment * alignment;
+#if TM_PLATFORM_WINDOWS
+  return alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? _aligned_malloc( rounded > 0 ? rounded : alignment, alignment ) : malloc( size > 0 ? size : 1 );
+#else
+  return alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? aligned_alloc( alignment, rounded > 0 ? rounded : alignment ) : malloc( size > 0 ? size : 1 );
+#endif
+}
+
+static void tm_replay_free( void *pointer, const size_t alignment )
+{
+#if TM_PLATFORM_WINDOWS
+  if( alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) { _aligned_free( pointer ); return; }
+#else
+  (void)alignment;
+#endif
+  free( pointer );
+}
+
+static void *tm_replay_allocate_or_throw( const size_t size, const size_t alignment )
+{
+  void *pointer = tm_replay_allocate( size, alignment );
+  if( pointer == nullptr ) { throw std::bad_alloc(); }
+  return pointer;
+}
+
+void *operator new( size_t size )                                                          { return tm_replay_allocate_or_throw( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void *operator new[]( size_t size )                                                        { return tm_replay_allocate_or_throw( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void *operator new( size_t size, std::align_val_t alignment )                              { return tm_replay_allocate_or_throw( size, static_cast<size_t>( alignment ) ); }
+void *operator new[]( size_t size, std::align_val_t alignment )                            { return tm_replay_allocate_or_throw( size, static_cast<size_t>( alignment ) ); }
+void *operator new( size_t size, const std::nothrow_t & ) noexcept                         { return tm_replay_allocate( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void *operator new[]( size_t size, const std::nothrow_t & ) noexcept                       { return tm_replay_allocate( size, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void *operator new( size_t size, std::align_val_t alignment, const std::nothrow_t & ) noexcept   { return tm_replay_allocate( size, static_cast<size_t>( alignment ) ); }
+void *operator new[]( size_t size, std::align_val_t alignment, const std::nothrow_t & ) noexcept { return tm_replay_allocate( size, static_cast<size_t>( alignment ) ); }
+
+void operator delete( void *pointer ) noexcept                                             { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete[]( void *pointer ) noexcept                                           { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete( void *pointer, size_t ) noexcept                                     { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete[]( void *pointer, size_t ) noexcept                                   { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete( void *pointer, std::align_val_t alignment ) noexcept                 { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+void operator delete[]( void *pointer, std::align_val_t alignment ) noexcept               { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+void operator delete( void *pointer, size_t, std::align_val_t alignment ) noexcept         { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+void operator delete[]( void *pointer, size_t, std::align_val_t alignment ) noexcept       { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+void operator delete( void *pointer, const std::nothrow_t & ) noexcept                     { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete[]( void *pointer, const std::nothrow_t & ) noexcept                   { tm_replay_free( pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__ ); }
+void operator delete( void *pointer, std::align_val_t alignment, const std::nothrow_t & ) noexcept   { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+void operator delete[]( void *pointer, std::align_val_t alignment, const std::nothrow_t & ) noexcept { tm_replay_free( pointer, static_cast<size_t>( alignment ) ); }
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the frames to play, all loaded before the first Update so that reading does not disturb timing
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+struct tm_replay_frame
+{
+  tm_uint64 Timestamp;      // nanoseconds
+  tm_double DeltaTime;
+  tm_uint32 NumMessages;
+  tm_uint32 Offset;         // into tm_replay::ByteStreams
+  tm_uint32 Size;
+};
+
+struct tm_replay
+{
+  std::vector<tm_replay_frame> Frames;
+  std::vector<tm_uint8>        ByteStreams;
+
+  void Add( const tm_uint64 timestamp, const tm_double delta_time, const tm_uint32 num_messages, const tm_uint8 *byte_stream, const tm_uint32 size )
+  {
+    Frames.push_back( { timestamp, delta_time, num_messages, static_cast<tm_uint32>( ByteStreams.size() ), size } );
+    ByteStreams.insert( ByteStreams.end(), byte_stream, byte_stream + size );
+  }
+
+  const tm_uint8 *GetByteStream( const tm_replay_frame &frame ) const { return ByteStreams.data() + frame.Offset; }
+};
+
+static bool LoadRecording( const char *path, const double start, const tm_uint64 max_frames, tm_replay &replay )
+{
+  tm_frame_log_reader reader;
+  if( !reader.Open( path ) ) { return false; }
+
+  const tm_uint64 start_timestamp = static_cast<tm_uint64>( start * 1e9 );
+  if( start > 0 && !reader.HasIndex() ) { printf( "%s has no index, reading from the beginning\n", path ); }
+  reader.Seek( start_timestamp );
+
+  tm_frame_log_record   record;
+  std::vector<tm_uint8> byte_stream;
+  while( replay.Frames.size() < max_frames && reader.Next( record, byte_stream ) )
+  {
+    if( record.Timestamp < start_timestamp ) { continue; }
+    replay.Add( record.Timestamp, record.DeltaTime, record.NumMessages, byte_stream.data(), record.Size );
+  }
+
+  return true;
+}
+
+//
+// the motion of the synthetic flight: a coordinated turn at 0.2 rad/s with a speed that changes
+// between 55 and 65 m/s. the global frame has z up, the body frame x forward, y left and z up.
+//
+struct tm_synthetic_motion
+{
+  tm_vector3d    Velocity;
+  tm_vector3d    Acceleration;
+  tm_vector3d    AngularVelocity;     // body
+  tm_quaterniond Orientation;         // body to global
+
+  explicit tm_synthetic_motion( const tm_double time )
+  {
+    const double turn_rate = 0.2;
+    const double speed     = 60.0 + 5.0 * sin( 0.5 * time );
+    const double speed_dot = 2.5 * cos( 0.5 * time );
+    const double heading   = turn_rate * time;
+    const double bank      = atan( speed * turn_rate / tm_standard_gravity );
+
+    Velocity     = { speed * cos( heading ), speed * sin( heading ), 0 };
+    Acceleration = { speed_dot * cos( heading ) - speed * turn_rate * sin( heading ),
+                     speed_dot * sin( heading ) + speed * turn_rate * cos( heading ), 0 };
+
+    // yaw about global z, then bank about body x with the left wing down, into the turn
+    const tm_quaterniond yaw( cos( heading / 2 ), 0, 0, sin( heading / 2 ) );
+    const tm_quaterniond roll( cos( -bank / 2 ), sin( -bank / 2 ), 0, 0 );
+    Orientation = yaw * roll;
+
+    const tm_quaterniond w = tm_QuaternionRot( tm_QuaternionConj( Orientation ), tm_quaterniond( 0, 0, 0, turn_rate ) );
+    AngularVelocity = { w.x, w.y, w.z };
+  }
+};
+
+//
+// a flight-like session at 60 fps: the first num_messages catalog entries, a quarter of them
+// change every frame. the messages of the aircraft motion follow tm_synthetic_motion,
+// Aircraft.Acceleration is only updated once per second like in the simulation and
+// Aircraft.Orientation is sent as a quaternion.
+//
+static void CreateSynthetic( const tm_uint32 num_messages, const tm_uint64 num_frames, tm_replay &replay )
+{
+  const tm_double       delta_time = 1.0 / 60.0;
+  std::vector<tm_uint8> byte_stream( num_messages * tm_external_message::GetMaxSize() );
+
+  for( tm_uint64 f = 0; f < num_frames; ++f )
+  {
+    const tm_double           time = f * delta_time;
+    const tm_synthetic_motion motion( time );
+    const tm_synthetic_motion sampled( floor( time ) );
+    const tm_vector3d         gravity( 0, 0, -tm_standard_gravity );
+    tm_uint32                 pos  = 0;
+
+    for( tm_uint32 i = 0; i < num_messages; ++i )
+    {
+      const auto &entry     = tm_message_catalog[i % tm_message_count];
+      const auto  index     = static_cast<tm_message_index>( i % tm_message_count );
+      const auto  data_type = index == tm_message_index::AircraftOrientation ? tm_msg_data_type::Vector4d : entry.DataType;
+      const auto  data_size = static_cast<tm_uint32>( tm_msg_data_type_size( data_type ) );
+
+      tm_msg_header header( entry.ID, data_type, static_cast<tm_msg_flag>( entry.Flag ), entry.Access, entry.Unit );
+      header.MessageSize = static_cast<tm_uint16>( sizeof( tm_msg_header ) + data_size );
+      memcpy( &byte_stream[pos], &header, sizeof( header ) );
+      pos += sizeof( header );
+
+      const double *motion_value = index == tm_message_index::AircraftVelocity        ? &motion.Velocity.x
+                                 : index == tm_message_index::AircraftAcceleration    ? &sampled.Acceleration.x
+                                 : index == tm_message_index::AircraftAngularVelocity ? &motion.AngularVelocity.x
+                                 : index == tm_message_index::AircraftOrientation     ? &motion.Orientation.r
+                                 : index == tm_message_index::AircraftGravity         ? &gravity.x
+                                 : nullptr;
+
+      memset( &byte_stream[pos], 0, data_size );
+      if( entry.DataType == tm_msg_data_type::String || entry.DataType == tm_msg_data_type::String8 )
+      {
+        snprintf( reinterpret_cast<char*>( &byte_stream[pos] ), data_size, "%s", tm_message_catalog_get_name( entry ) );
+      }
+      else if( motion_value != nullptr )
+      {
+        memcpy( &byte_stream[pos], motion_value, data_size );
+      }
+      else
+      {
+        // every 4th message changes every frame, the others like switches, settings and
+        // frequencies only every few seconds
+        const double period = 2.0 + i % 11;
+        const double t      = i % 4 == 0 ? time : floor( time / period ) * period;
+        for( tm_uint32 k = 0; k < data_size / sizeof( double ); ++k )
+        {
+          const double value = sin( 0.5 * t + i + k );
+          memcpy( &byte_stream[pos + k * sizeof( double )], &value, sizeof( double ) );
+        }
+      }
+      pos += data_size;
+    }
+
+    replay.Add( static_cast<tm_uint64>( time * 1e9 ), delta_time, num_messages, byte_stream.data(), pos );
+  }
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the specific force the dll derives from Aircraft.Velocity against Aircraft.Acceleration, which
+// the simulation only updates about once per second. every new acceleration sample is compared
+// with the estimate of the same frame and with the mean of the estimates since the previous one.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+struct tm_specific_force_error
+{
+  tm_vector3d SumSquares;
+  tm_vector3d Max;
+
+  void Add( const tm_vector3d &estimate, const tm_vector3d &reference )
+  {
+    const tm_vector3d e = ( estimate - reference ) * ( 1.0 / tm_standard_gravity );
+    SumSquares = SumSquares + tm_vector3d( e.x * e.x, e.y * e.y, e.z * e.z );
+    Max        = { fmax( Max.x, fabs( e.x ) ), fmax( Max.y, fabs( e.y ) ), fmax( Max.z, fabs( e.z ) ) };
+  }
+
+  void Print( const char *name, const tm_uint64 num_samples ) const
+  {
+    const tm_vector3d rms = SumSquares * ( 1.0 / ( num_samples > 0 ? num_samples : 1 ) );
+    printf( "%-18s rms %8.4f %8.4f %8.4f g   max %8.4f %8.4f %8.4f g\n", name, sqrt( rms.x ), sqrt( rms.y ), sqrt( rms.z ), Max.x, Max.y, Max.z );
+  }
+};
+
+static void CheckSpecificForce( const tm_replay &replay )
+{
+  tm_specific_force_estimator estimator;
+  tm_specific_force_error     instant_error;
+  tm_specific_force_error     mean_error;
+  tm_vector3d                 previous_acceleration;
+  tm_vector3d                 estimate_sum;
+  tm_vector3d                 last_estimate;
+  tm_uint64                   num_estimates = 0;
+  tm_uint64                   num_samples   = 0;
+  bool                        has_sample    = false;
+
+  for( const auto &frame : replay.Frames )
+  {
+    for( const auto message : tm_external_message_stream( replay.GetByteStream( frame ), frame.Size, frame.NumMessages ) )
+    {
+      estimator.Observe( tm_message_lookup( message.GetID() ), message );
+    }
+    estimator.Update( frame.DeltaTime );
+    if( !estimator.IsValid() ) { continue; }
+
+    last_estimate = estimator.GetSpecificForce();
+    estimate_sum  = estimate_sum + last_estimate;
+    ++num_estimates;
+
+    const tm_vector3d acceleration = estimator.GetAcceleration();
+    const bool        new_sample   = acceleration.x != previous_acceleration.x || acceleration.y != previous_acceleration.y || acceleration.z != previous_acceleration.z;
+    previous_acceleration = acceleration;
+    if( !new_sample ) { continue; }
+
+    // the first sample has no complete interval before it
+    const tm_vector3d reference = estimator.GetReferenceSpecificForce();
+    instant_error.Add( last_estimate, reference );
+    if( has_sample ) { mean_error.Add( estimate_sum * ( 1.0 / num_estimates ), reference ); }
+
+    estimate_sum  = tm_vector3d();
+    num_estimates = 0;
+    has_sample    = true;
+    ++num_samples;
+  }
+
+  printf( "specific force    %12llu samples of Aircraft.Acceleration, errors longitudinal lateral vertical\n", static_cast<unsigned long long>( num_samples ) );
+  if( num_samples == 0 ) { return; }
+  instant_error.Print( "  same frame", num_samples );
+  mean_error.Print( "  interval mean", num_samples > 1 ? num_samples - 1 : 1 );
+  printf( "  last estimate     %8.4f %8.4f %8.4f g\n", last_estimate.x / tm_standard_gravity, last_estimate.y / tm_standard_gravity, last_estimate.z / tm_standard_gravity );
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// main
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintUsage()
+{
+  printf( "usage: replay <dll> <recording.afrl | synthetic:<num_messages>> [--speed realtime|N|max] [--start seconds] [--frames count] [--loop count]\n"
+          "                                                             [--check-specific-force] [--check-allocations]\n" );
+}
+
+static double GetPercentile( const std::vector<tm_uint64> &sorted, const double p )
+{
+  if( sorted.empty() ) { return 0; }
+  const size_t i = static_cast<size_t>( p / 100.0 * ( sorted.size() - 1 ) + 0.5 );
+  return static_cast<double>( sorted[i < sorted.size() ? i : sorted.size() - 1] );
+}
+
+int main( int argc, char *argv[] )
+{
+  if( argc < 3 ) { PrintUsage(); return 1; }
+
+  const char *dll_path   = argv[1];
+  const char *input      = argv[2];
+  double      speed      = 1.0;       // 0 plays as fast as possible
+  double      start      = 0.0;
+  tm_uint64   max_frames = ~tm_uint64( 0 );
+  tm_uint32   loops      = 1;
+  bool        check      = false;
+  bool        check_allocations = false;
+
+  for( int i = 3; i < argc; ++i )
+  {
+    if( strcmp( argv[i], "--check-specific-force" ) == 0 ) { check = true; continue; }
+    if( strcmp( argv[i], "--check-allocations" ) == 0 )    { check_allocations = true; continue; }
+    if( i + 1 == argc )                                    { PrintUsage(); return 1; }
+
+    if(      strcmp( argv[i], "--speed" ) == 0 )  { speed = strcmp( argv[i + 1], "max" ) == 0 ? 0.0 : strcmp( argv[i + 1], "realtime" ) == 0 ? 1.0 : atof( argv[i + 1] ); }
+    else if( strcmp( argv[i], "--start" ) == 0 )  { start = atof( argv[i + 1] ); }
+    else if( strcmp( argv[i], "--frames" ) == 0 ) { max_frames = strtoull( argv[i + 1], nullptr, 10 ); }
+    else if( strcmp( argv[i], "--loop" ) == 0 )   { loops = static_cast<tm_uint32>( strtoul( argv[i + 1], nullptr, 10 ) ); }
+    else                                          { PrintUsage(); return 1; }
+    ++i;
+  }
+
+  if( speed < 0 || loops == 0 ) { PrintUsage(); return 1; }
+
+  tm_replay replay;
+  if( strncmp( input, "synthetic:", 10 ) == 0 )
+  {
+    const tm_uint32 num_messages = static_cast<tm_uint32>( strtoul( input + 10, nullptr, 10 ) );
+    CreateSynthetic( num_messages, max_frames != ~tm_uint64( 0 ) ? max_frames : 3600, replay );
+  }
+  else if( !LoadRecording( input, start, max_frames, replay ) )
+  {
+    printf( "cannot read recording '%s'\n", input );
+    return 1;
+  }
+
+  if( replay.Frames.empty() ) { printf( "no frames to play\n" ); return 1; }
+
+  if( check ) { CheckSpecificForce( replay ); }
+
+  tm_external_dll dll;
+  if( !dll.Load( dll_path ) )
+  {
+    printf( "cannot load '%s' or it does not export the Aerofly FS 2 interface\n", dll_path );
+    return 1;
+  }
+
+  const int interface_version = dll.GetInterfaceVersion();
+  if( interface_version != TM_DLL_INTERFACE_VERSION )
+  {
+    printf( "interface version %d, expected %d\n", interface_version, TM_DLL_INTERFACE_VERSION );
+    dll.Unload();
+    return 1;
+  }
+
+  // the simulation passes its own instance handle
+#if TM_PLATFORM_WINDOWS
+  const HINSTANCE host_instance = GetModuleHandleA( nullptr );
+#else
+  const HINSTANCE host_instance = nullptr;
+#endif
+
+  if( !dll.Init( host_instance ) )
+  {
+    printf( "Aerofly_FS_2_External_DLL_Init failed\n" );
+    dll.Unload();
+    return 1;
+  }
+
+  // the buffer the dll writes the messages it sends to the simulation into
+  std::vector<tm_uint8>  sent_byte_stream( 64 * 1024 );
+  std::vector<tm_uint64> latencies;
+  tm_uint64              total_sent_messages = 0;
+  tm_uint64              num_frames          = 0;
+  tm_uint64              first_allocation    = 0;       // the frame of the first counted allocation
+  latencies.reserve( replay.Frames.size() * loops );
+
+  // the first second of frames warms the dll up
+  const tm_uint64 warmup_frames = 60;
+
+  const auto play_start = std::chrono::steady_clock::now();
+  auto       loop_start = play_start;
+
+  for( tm_uint32 loop = 0; loop < loops; ++loop )
+  {
+    const tm_uint64 first_timestamp = replay.Frames.front().Timestamp;
+
+    for( const auto &frame : replay.Frames )
+    {
+      if( speed > 0 )
+      {
+        const auto due = loop_start + std::chrono::nanoseconds( static_cast<tm_uint64>( ( frame.Timestamp - first_timestamp ) / speed ) );
+        std::this_thread::sleep_until( due );
+      }
+
+      tm_uint32 sent_byte_stream_size = 0;
+      tm_uint32 sent_num_messages     = 0;
+
+      const tm_uint64 allocations = global_allocations;
+      global_count_allocations    = check_allocations && num_frames >= warmup_frames;
+
+      const auto update_start = std::chrono::steady_clock::now();
+      dll.Update( frame.DeltaTime, replay.GetByteStream( frame ), frame.Size, frame.NumMessages,
+                  sent_byte_stream.data(), sent_byte_stream_size, sent_num_messages, static_cast<tm_uint32>( sent_byte_stream.size() ) );
+      const auto update_stop = std::chrono::steady_clock::now();
+
+      global_count_allocations = false;
+      if( allocations == 0 && global_allocations > 0 ) { first_allocation = num_frames; }
+      ++num_frames;
+
+      latencies.push_back( static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( update_stop - update_start ).count() ) );
+      total_sent_messages += sent_num_messages;
+    }
+
+    loop_start = std::chrono::steady_clock::now();
+  }
+
+  const double play_seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - play_start ).count();
+
+  dll.Shutdown();
+  dll.Unload();
+
+  std::sort( latencies.begin(), latencies.end() );
+
+  printf( "frames            %12llu\n",    static_cast<unsigned long long>( latencies.size() ) );
+  printf( "frames per second %12.1f\n",    latencies.size() / play_seconds );
+  printf( "messages sent     %12llu\n",    static_cast<unsigned long long>( total_sent_messages ) );
+  printf( "update p50        %12.0f ns\n", GetPercentile( latencies, 50 ) );
+  printf( "update p90        %12.0f ns\n", GetPercentile( latencies, 90 ) );
+  printf( "update p99        %12.0f ns\n", GetPercentile( latencies, 99 ) );
+  printf( "update p99.9      %12.0f ns\n", GetPercentile( latencies, 99.9 ) );
+  printf( "update max        %12.0f ns\n", static_cast<double>( latencies.back() ) );
+
+  if( check_allocations )
+  {
+    const tm_uint64 counted = num_frames > warmup_frames ? num_frames - warmup_frames : 0;
+    printf( "allocations       %12llu in %llu frames after %llu warm-up frames\n", static_cast<unsigned long long>( global_allocations ),
+            static_cast<unsigned long long>( counted ), static_cast<unsigned long long>( num_frames - counted ) );
+    if( global_allocations > 0 )
+    {
+      printf( "first allocation  %12llu bytes in frame %llu\n", static_cast<unsigned long long>( global_allocation_size ), static_cast<unsigned long long>( first_allocation ) );
+      return 1;
+    }
+  }
+
+  return 0;
+}
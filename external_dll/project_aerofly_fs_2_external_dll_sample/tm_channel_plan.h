@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_channel_plan.h - which received messages end up in which telemetry values
+//
+// A subscription names one MESSAGE_LIST entry and how its value is transformed. Scalars become
+// one telemetry value, vectors one value per component, in the order of the subscriptions.
+//
+// tm_channel_plan is built once from the subscriptions. It keeps one small table indexed by
+// tm_message_index that points at the subscriptions of that message, so a frame costs one
+// lookup per received message plus clearing the subscribed values, independent of the catalog.
+//
+// Global vectors can be sent in the local east/north/up or north/east/down frame at the aircraft
+// position. Their values are collected as received and rotated together in FinishFrame().
+//
+// Update fills the values either from the received messages with BeginFrame() and Extract() for
+// each of them, or from tm_state_table.h with one Extract() of the table. Channels of messages
+// that were not received in this update are 0 with the former and keep their last value with
+// the latter.
+//
+// GetOutputChannels() tells tm_output_scheduler.h which values are angles, which are discrete and
+// which have their rate sent along, see tm_channel_rate_links.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_CHANNEL_PLAN_H
+#define TM_CHANNEL_PLAN_H
+
+#include "tm_external_message_view.h"
+#include "tm_local_frame.h"
+#include "tm_message_catalog.h"
+#include "tm_output_scheduler.h"
+#include "tm_state_table.h"
+#include "../shared/telemetry/tm_telemetry_frame.h"
+
+#include <initializer_list>
+#include <string.h>
+
+
+enum class tm_channel_frame : tm_uint8
+{
+  Global,       // as received
+  ENU,          // Vector3d only, see tm_local_frame_axes
+  NED
+};
+
+struct tm_channel_subscription
+{
+  tm_message_index Index   = tm_message_index::Count;
+  double           Scale   = 1.0;
+  double           Offset  = 0.0;
+  double           Wrap    = 0.0;   // if not 0, raw values above Wrap / 2 are lowered by Wrap
+  tm_channel_frame Frame   = tm_channel_frame::Global;
+  double           Epsilon = 0.0;   // smallest change delta frames send, in sent units
+};
+
+// the channels of the original dll, in the order the consumers expect them
+inline constexpr tm_channel_subscription tm_channel_default_subscriptions[] =
+{
+  { tm_message_index::AircraftPitch },
+  { tm_message_index::AircraftBank, 1.0, 0.0, 6.0 },          // the original dll mapped bank > 3 to bank - 6
+  { tm_message_index::AircraftRateOfTurn },
+  { tm_message_index::AircraftAngularVelocity },              // Aircraft.Acceleration would be a better information, but the api gives only 1 value per second
+  { tm_message_index::AircraftVelocity },
+  { tm_message_index::AircraftIndicatedAirspeed },
+  { tm_message_index::AircraftGroundSpeed },
+};
+
+// messages the simulation sends the rate of, dead-reckoned with it when both are subscribed in the
+// same frame. Aircraft.Velocity is global unless it has the Body flag, which the simulation does not set.
+struct tm_channel_rate_link
+{
+  tm_message_index Value;
+  tm_message_index Rate;
+};
+
+inline constexpr tm_channel_rate_link tm_channel_rate_links[] =
+{
+  { tm_message_index::AircraftPosition,        tm_message_index::AircraftVelocity },
+  { tm_message_index::AircraftAltitude,        tm_message_index::AircraftVerticalSpeed },
+  { tm_message_index::AircraftTrueHeading,     tm_message_index::AircraftRateOfTurn },
+  { tm_message_index::AircraftMagneticHeading, tm_message_index::AircraftRateOfTurn },
+};
+
+// number of telemetry values a message of this type produces, 0 if it cannot be forwarded
+constexpr tm_uint32 tm_channel_get_value_count( const tm_msg_data_type data_type )
+{
+  switch( data_type )
+  {
+    case tm_msg_data_type::Int:      return 1;
+    case tm_msg_data_type::Double:   return 1;
+    case tm_msg_data_type::Vector2d: return 2;
+    case tm_msg_data_type::Vector3d: return 3;
+    case tm_msg_data_type::Vector4d: return 4;
+    default:                         return 0;
+  }
+}
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the plan
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_channel_plan
+{
+private:
+  static constexpr tm_uint8 None = 0xff;
+
+  struct tm_channel_plan_entry
+  {
+    double           Scale;
+    double           Offset;
+    double           Wrap;
+    double           Epsilon;
+    tm_uint8         FirstValue;
+    tm_uint8         NumValues;
+    tm_uint8         Next;          // next subscription of the same message or None
+    tm_msg_data_type DataType;
+    tm_channel_frame Frame;
+    tm_message_index Index;
+  };
+
+  static_assert( tm_telemetry_max_channels < None, "value indices do not fit into 8 bits" );
+
+  tm_uint8              First[tm_message_count];
+  tm_channel_plan_entry Entries[tm_telemetry_max_channels];
+  tm_uint8              LocalEntries[tm_telemetry_max_channels];
+  tm_uint32             NumEntries      = 0;
+  tm_uint32             NumValues       = 0;
+  tm_uint32             NumLocalEntries = 0;
+
+  double Transform( const tm_channel_plan_entry &entry, double value ) const
+  {
+    if( entry.Wrap != 0.0 && value > entry.Wrap * 0.5 ) { value -= entry.Wrap; }
+    return value * entry.Scale + entry.Offset;
+  }
+
+  // the values of one subscription from a payload of the subscribed type
+  void ExtractEntry( const tm_channel_plan_entry &entry, const tm_uint8 *data, const tm_uint32 data_size, tm_telemetry_frame &frame ) const
+  {
+    if( entry.DataType == tm_msg_data_type::Int )
+    {
+      tm_int64 value;
+      memcpy( &value, data, sizeof( value ) );
+      frame.Values[entry.FirstValue] = Transform( entry, static_cast<double>( value ) );
+      return;
+    }
+
+    // vectors in a local frame are transformed after the rotation in FinishFrame()
+    const tm_uint32 num_values = data_size / sizeof( double ) < entry.NumValues ? data_size / sizeof( double ) : entry.NumValues;
+    for( tm_uint32 i = 0; i < num_values; ++i )
+    {
+      double value;
+      memcpy( &value, data + i * sizeof( double ), sizeof( double ) );
+      frame.Values[entry.FirstValue + i] = entry.Frame == tm_channel_frame::Global ? Transform( entry, value ) : value;
+    }
+  }
+
+public:
+  tm_channel_plan() { Clear(); }
+
+  void Clear()
+  {
+    memset( First, None, sizeof( First ) );
+    NumEntries      = 0;
+    NumValues       = 0;
+    NumLocalEntries = 0;
+  }
+
+  tm_uint32 GetNumValues()        const { return NumValues; }
+  tm_uint32 GetNumSubscriptions() const { return NumEntries; }
+  bool      HasLocalFrame()       const { return NumLocalEntries > 0; }
+
+  //
+  // appends a subscription, returns false if the message cannot be forwarded or the values do not
+  // fit into a frame
+  //
+  bool Add( const tm_channel_subscription &subscription )
+  {
+    const auto *catalog_entry = tm_message_catalog_find( subscription.Index );
+    if( catalog_entry == nullptr ) { return false; }
+
+    const tm_uint32 num_values = tm_channel_get_value_count( catalog_entry->DataType );
+    if( num_values == 0 || NumValues + num_values > tm_telemetry_max_channels ) { return false; }
+    if( subscription.Frame != tm_channel_frame::Global && catalog_entry->DataType != tm_msg_data_type::Vector3d ) { return false; }
+
+    tm_channel_plan_entry &entry = Entries[NumEntries];
+    entry.Scale      = subscription.Scale;
+    entry.Offset     = subscription.Offset;
+    entry.Wrap       = subscription.Wrap;
+    entry.Epsilon    = subscription.Epsilon;
+    entry.FirstValue = static_cast<tm_uint8>( NumValues );
+    entry.NumValues  = static_cast<tm_uint8>( num_values );
+    entry.Next       = None;
+    entry.DataType   = catalog_entry->DataType;
+    entry.Frame      = subscription.Frame;
+    entry.Index      = subscription.Index;
+    if( entry.Frame != tm_channel_frame::Global ) { LocalEntries[NumLocalEntries++] = static_cast<tm_uint8>( NumEntries ); }
+
+    // keep the subscriptions of one message in order
+    tm_uint8 *link = &First[static_cast<tm_uint32>( subscription.Index )];
+    while( *link != None ) { link = &Entries[*link].Next; }
+    *link = static_cast<tm_uint8>( NumEntries );
+
+    ++NumEntries;
+    NumValues += num_values;
+    return true;
+  }
+
+  //
+  // starts a frame, values of messages that are not received in this update stay 0
+  //
+  void BeginFrame( tm_telemetry_frame &frame ) const
+  {
+    frame.SetAllChannels( NumValues );
+    memset( frame.Values, 0, NumValues * sizeof( frame.Values[0] ) );
+  }
+
+  //
+  // writes the values of one received message into the frame, if it is subscribed
+  //
+  void Extract( const tm_external_message_view message, tm_telemetry_frame &frame ) const
+  {
+    Extract( tm_message_lookup( message.GetID() ), message, frame );
+  }
+
+  // the same for callers that already looked up the index of the message
+  void Extract( const tm_message_index index, const tm_external_message_view message, tm_telemetry_frame &frame ) const
+  {
+    if( index == tm_message_index::Count ) { return; }
+
+    for( tm_uint8 e = First[static_cast<tm_uint32>( index )]; e != None; e = Entries[e].Next )
+    {
+      const tm_channel_plan_entry &entry = Entries[e];
+      if( message.GetDataType() == entry.DataType ) { ExtractEntry( entry, message.GetDataPointer(), message.GetDataSize(), frame ); }
+    }
+  }
+
+  //
+  // starts a frame with every subscribed value from the table, the last received one. values of
+  // messages that were never received, or with another type, are 0.
+  //
+  void Extract( const tm_state_table &state, tm_telemetry_frame &frame ) const
+  {
+    BeginFrame( frame );
+
+    for( tm_uint32 e = 0; e < NumEntries; ++e )
+    {
+      const tm_channel_plan_entry &entry = Entries[e];
+      if( state.GetDataType( entry.Index ) != entry.DataType ) { continue; }
+      ExtractEntry( entry, reinterpret_cast<const tm_uint8*>( state.GetValues( entry.Index ) ), state.GetDataSize( entry.Index ), frame );
+    }
+  }
+
+  //
+  // after the last Extract of a frame, rotates the vectors that are sent in a local frame. the
+  // vectors of one frame type are gathered and rotated in one batch.
+  //
+  void FinishFrame( tm_telemetry_frame &frame, const tm_local_frame &local_frame ) const
+  {
+    double vectors[tm_telemetry_max_channels];
+
+    for( const tm_channel_frame channel_frame : { tm_channel_frame::ENU, tm_channel_frame::NED } )
+    {
+      tm_uint32 count = 0;
+      for( tm_uint32 i = 0; i < NumLocalEntries; ++i )
+      {
+        const tm_channel_plan_entry &entry = Entries[LocalEntries[i]];
+        if( entry.Frame != channel_frame ) { continue; }
+        memcpy( &vectors[count * 3], &frame.Values[entry.FirstValue], 3 * sizeof( double ) );
+        ++count;
+      }
+      if( count == 0 ) { continue; }
+
+      local_frame.ToLocal( vectors, vectors, count, 3, channel_frame == tm_channel_frame::ENU ? tm_local_frame_axes::ENU : tm_local_frame_axes::NED );
+
+      count = 0;
+      for( tm_uint32 i = 0; i < NumLocalEntries; ++i )
+      {
+        const tm_channel_plan_entry &entry = Entries[LocalEntries[i]];
+        if( entry.Frame != channel_frame ) { continue; }
+        for( tm_uint32 k = 0; k < 3; ++k ) { frame.Values[entry.FirstValue + k] = Transform( entry, vectors[count * 3 + k] ); }
+        ++count;
+      }
+    }
+  }
+
+  // the epsilon of each of the GetNumValues() values, for tm_telemetry_delta_encoder
+  void GetDeltaEpsilons( double *epsilons ) const
+  {
+    for( tm_uint32 e = 0; e < NumEntries; ++e )
+    {
+      for( tm_uint32 k = 0; k < Entries[e].NumValues; ++k ) { epsilons[Entries[e].FirstValue + k] = Entries[e].Epsilon; }
+    }
+  }
+
+  //
+  // how tm_output_scheduler.h samples each of the GetNumValues() values between frames
+  //
+  void GetOutputChannels( tm_output_channel *channels ) const
+  {
+    constexpr double two_pi = 6.283185307179586;
+
+    for( tm_uint32 e = 0; e < NumEntries; ++e )
+    {
+      const tm_channel_plan_entry &entry         = Entries[e];
+      const auto                  *catalog_entry = tm_message_catalog_find( entry.Index );
+      const double                 scale         = entry.Scale < 0 ? -entry.Scale : entry.Scale;
+
+      for( tm_uint32 k = 0; k < entry.NumValues; ++k )
+      {
+        tm_output_channel &channel = channels[entry.FirstValue + k];
+        channel      = tm_output_channel();
+        channel.Hold = entry.DataType == tm_msg_data_type::Int;
+
+        // scalar angles, the ones moved by wrap have its period
+        if(      entry.NumValues == 1 && entry.Wrap != 0 )                             { channel.Period = entry.Wrap * scale; }
+        else if( entry.NumValues == 1 && catalog_entry->Unit == tm_msg_unit::Radiant ) { channel.Period = two_pi * scale; }
+      }
+    }
+
+    for( const auto &link : tm_channel_rate_links )
+    {
+      const tm_uint8 v = First[static_cast<tm_uint32>( link.Value )];
+      const tm_uint8 r = First[static_cast<tm_uint32>( link.Rate )];
+      if( v == None || r == None ) { continue; }
+
+      const tm_channel_plan_entry &value = Entries[v];
+      const tm_channel_plan_entry &rate  = Entries[r];
+      if( value.NumValues != rate.NumValues || value.Frame != rate.Frame || rate.Scale == 0 || rate.Wrap != 0 ) { continue; }
+
+      for( tm_uint32 k = 0; k < value.NumValues; ++k )
+      {
+        tm_output_channel &channel = channels[value.FirstValue + k];
+        channel.RateValue  = static_cast<tm_uint8>( rate.FirstValue + k );
+        channel.RateScale  = value.Scale / rate.Scale;
+        channel.RateOffset = rate.Offset;
+      }
+    }
+  }
+};
+
+#endif  // TM_CHANNEL_PLAN_H
@@ -0,0 +1,324 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_command_listener.h - messages from external tools that Update sends to the simulation
+//
+// A listener thread receives udp datagrams with one command per line,
+//
+//   <name> <value> [<value> ...] [flag=<flag>]
+//
+// e.g. "Controls.Throttle1 0.8" or "Command.Execute 1 flag=event". The name is one of
+// MESSAGE_LIST, the values fill the data type of its catalog entry and the flag replaces the
+// catalog flag: value, event, toggle, offset, step, move or active. Empty lines and lines starting
+// with '#' are skipped. Messages whose catalog entry is not Write or ReadWrite are rejected.
+//
+// The parsed messages go through a lock-free ring to the simulation thread. AddToByteStream()
+// appends as many of them as fit into the byte stream of Update, the rest stays queued in order
+// for the next Update. The listener never blocks the simulation, when the ring is full newer
+// commands are dropped.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_COMMAND_LISTENER_H
+#define TM_COMMAND_LISTENER_H
+
+#include "../shared/input/tm_external_message.h"
+#include "tm_channel_plan.h"
+#include "tm_message_catalog.h"
+#include "tm_platform.h"
+#include "tm_spsc_queue.h"
+#include "tm_udp_sender.h"
+
+#include <atomic>
+#include <thread>
+#include <stdlib.h>
+#include <string.h>
+
+
+constexpr tm_uint32 tm_command_max_line_length = 256;
+
+struct tm_command_stats
+{
+  tm_uint64 Received = 0;     // commands parsed and queued
+  tm_uint64 Rejected = 0;     // invalid or not writeable
+  tm_uint64 Dropped  = 0;     // the ring was full
+  tm_uint64 Sent     = 0;     // added to the byte stream of Update
+  tm_uint64 Deferred = 0;     // updates that left commands queued because the byte stream was full
+};
+
+struct tm_command_flag_name
+{
+  const char *Name;
+  tm_msg_flag Flag;
+};
+
+inline constexpr tm_command_flag_name tm_command_flag_names[] =
+{
+  { "value",  tm_msg_flag::Value  },
+  { "event",  tm_msg_flag::Event  },
+  { "toggle", tm_msg_flag::Toggle },
+  { "offset", tm_msg_flag::Offset },
+  { "step",   tm_msg_flag::Step   },
+  { "move",   tm_msg_flag::Move   },
+  { "active", tm_msg_flag::Active },
+};
+
+
+//
+// parses one command line, returns nullptr or what is wrong with it
+//
+inline const char *tm_command_parse( const char *line, const tm_uint32 length, tm_external_message &message )
+{
+  char buffer[tm_command_max_line_length];
+  if( length >= sizeof( buffer ) ) { return "line is too long"; }
+  memcpy( buffer, line, length );
+  buffer[length] = 0;
+
+  char       *context = buffer;
+  const char *name    = tm_platform_next_token( context );
+  if( name == nullptr ) { return "missing message name"; }
+
+  const tm_message_index index = tm_message_catalog_find_index( name );
+  if( index == tm_message_index::Count ) { return "unknown message name"; }
+
+  const tm_message_catalog_entry &entry = *tm_message_catalog_find( index );
+  if( entry.Access != tm_msg_access::Write && entry.Access != tm_msg_access::ReadWrite ) { return "message is not writeable"; }
+
+  const tm_uint32 num_values = tm_channel_get_value_count( entry.DataType );
+  if( num_values == 0 ) { return "message has no numeric value"; }
+
+  double      values[4] = {};
+  tm_uint32   count     = 0;
+  tm_msg_flag flag      = static_cast<tm_msg_flag>( entry.Flag );
+  for( const char *token = tm_platform_next_token( context ); token != nullptr; token = tm_platform_next_token( context ) )
+  {
+    if( strncmp( token, "flag=", 5 ) == 0 )
+    {
+      const tm_command_flag_name *found = nullptr;
+      for( const auto &flag_name : tm_command_flag_names ) { if( strcmp( token + 5, flag_name.Name ) == 0 ) { found = &flag_name; } }
+      if( found == nullptr ) { return "unknown flag"; }
+      flag = found->Flag;
+      continue;
+    }
+
+    char *end = nullptr;
+    if( count == num_values ) { return "too many values"; }
+    values[count++] = strtod( token, &end );
+    if( end == token || *end != 0 ) { return "invalid value"; }
+  }
+
+  if( count != num_values ) { return "too few values"; }
+
+  message = tm_external_message( tm_string_hash( entry.ID ), entry.DataType, flag, entry.Access, entry.Unit );
+  switch( entry.DataType )
+  {
+    case tm_msg_data_type::Int:      message.SetValue( static_cast<tm_int64>( values[0] ) ); break;
+    case tm_msg_data_type::Double:   message.SetValue( values[0] ); break;
+    case tm_msg_data_type::Vector2d: message.SetValue( tm_vector2d( values[0], values[1] ) ); break;
+    case tm_msg_data_type::Vector3d: message.SetValue( tm_vector3d( values[0], values[1], values[2] ) ); break;
+    default:                         message.SetValue( tm_vector4d( values[0], values[1], values[2], values[3] ) ); break;
+  }
+
+  return nullptr;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_command_listener
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_command_listener
+{
+private:
+  static constexpr tm_uint32 MaxLoggedRejections = 16;
+
+  tm_spsc_queue<tm_external_message> Queue;
+  tm_socket                          Socket  = tm_socket_invalid;
+  bool                               Started = false;
+  std::thread                        Thread;
+  std::atomic<bool>                  Running{ false };
+  std::atomic<tm_uint64>             Received{ 0 };
+  std::atomic<tm_uint64>             Rejected{ 0 };
+
+  // simulation thread only, the command that did not fit into the last byte stream
+  tm_external_message                Pending;
+  bool                               HasPending = false;
+  tm_uint64                          Sent       = 0;
+  tm_uint64                          Deferred   = 0;
+
+  void Run()
+  {
+    char datagram[4096];
+
+    while( Running.load( std::memory_order_acquire ) )
+    {
+      // wake up now and then to see whether Stop() was called
+      fd_set  read_set;
+      timeval timeout = { 0, 100000 };
+      FD_ZERO( &read_set );
+      FD_SET( Socket, &read_set );
+      if( select( static_cast<int>( Socket + 1 ), &read_set, nullptr, nullptr, &timeout ) <= 0 ) { continue; }
+
+      for( ;; )
+      {
+        const auto size = recv( Socket, datagram, sizeof( datagram ), 0 );
+        if( size <= 0 ) { break; }
+        Receive( datagram, static_cast<tm_uint32>( size ) );
+      }
+    }
+  }
+
+public:
+  tm_command_listener() = default;
+  tm_command_listener( const tm_command_listener & ) = delete;
+  tm_command_listener &operator=( const tm_command_listener & ) = delete;
+  ~tm_command_listener() { Stop(); }
+
+  //
+  // allocates the ring and resets the counters, enough for Receive() and AddToByteStream()
+  // without a socket. not thread safe.
+  //
+  void Reset( const tm_uint32 queue_size )
+  {
+    Queue.Reset( queue_size );
+    Received.store( 0, std::memory_order_relaxed );
+    Rejected.store( 0, std::memory_order_relaxed );
+    HasPending = false;
+    Sent       = 0;
+    Deferred   = 0;
+  }
+
+  //
+  // binds to the address and starts the listener thread
+  //
+  bool Start( const char *hostname, const char *service, const tm_uint32 queue_size )
+  {
+    Stop();
+    Reset( queue_size );
+
+    Started = tm_socket_startup();
+    if( !Started ) { return false; }
+
+    sockaddr_storage address        = {};
+    tm_uint32        address_length = 0;
+    if( !tm_socket_resolve( hostname, service, address, address_length ) )
+    {
+      Stop();
+      return false;
+    }
+
+    Socket = socket( address.ss_family, SOCK_DGRAM, 0 );
+    if( Socket == tm_socket_invalid || bind( Socket, reinterpret_cast<const sockaddr*>( &address ), address_length ) != 0 )
+    {
+      Stop();
+      return false;
+    }
+
+    tm_socket_set_nonblocking( Socket );
+
+    Running.store( true, std::memory_order_release );
+    Thread = std::thread( &tm_command_listener::Run, this );
+    return true;
+  }
+
+  void Stop()
+  {
+    if( Thread.joinable() )
+    {
+      Running.store( false, std::memory_order_release );
+      Thread.join();
+    }
+
+    if( Socket != tm_socket_invalid )
+    {
+      tm_socket_close( Socket );
+      Socket = tm_socket_invalid;
+    }
+
+    if( Started )
+    {
+      tm_socket_cleanup();
+      Started = false;
+    }
+  }
+
+  bool IsRunning() const { return Running.load( std::memory_order_relaxed ); }
+
+  //
+  // listener side, parses the lines of one datagram and queues the valid commands
+  //
+  void Receive( const char *text, const tm_uint32 size )
+  {
+    for( tm_uint32 begin = 0; begin < size; )
+    {
+      tm_uint32 end = begin;
+      while( end < size && text[end] != '\n' ) { ++end; }
+
+      const char *line   = text + begin;
+      tm_uint32   length = end - begin;
+      begin = end + 1;
+
+      while( length > 0 && ( *line == ' ' || *line == '\t' ) ) { ++line; --length; }
+      if( length == 0 || *line == '#' || ( length == 1 && *line == '\r' ) ) { continue; }
+
+      tm_external_message message;
+      const char *error = tm_command_parse( line, length, message );
+      if( error != nullptr )
+      {
+        if( Rejected.fetch_add( 1, std::memory_order_relaxed ) < MaxLoggedRejections )
+        {
+          tm_platform_log( "command rejected, %s: '%.*s'", error, static_cast<int>( length < 64 ? length : 64 ), line );
+        }
+        continue;
+      }
+
+      if( Queue.Push( message, tm_queue_full_policy::DropNewest ) ) { Received.fetch_add( 1, std::memory_order_relaxed ); }
+    }
+  }
+
+  //
+  // simulation side, called in Update. appends the queued commands in order as long as they fit
+  // into 'byte_stream_size_max', the others are sent with one of the next updates.
+  //
+  void AddToByteStream( tm_uint8 *byte_stream, tm_uint32 &byte_stream_size, tm_uint32 &num_messages, const tm_uint32 byte_stream_size_max )
+  {
+    if( byte_stream == nullptr ) { return; }
+
+    for( ;; )
+    {
+      if( !HasPending )
+      {
+        if( !Queue.Pop( Pending ) ) { return; }
+        HasPending = true;
+      }
+
+      if( byte_stream_size + Pending.GetSize() > byte_stream_size_max )
+      {
+        // a command that does not even fit into an empty stream would block all others
+        if( byte_stream_size == 0 ) { HasPending = false; continue; }
+        ++Deferred;
+        return;
+      }
+
+      Pending.AddToByteStream( byte_stream, byte_stream_size, num_messages );
+      HasPending = false;
+      ++Sent;
+    }
+  }
+
+  // read on the simulation thread or after Stop()
+  tm_command_stats GetStats() const
+  {
+    tm_command_stats stats;
+    stats.Received = Received.load( std::memory_order_relaxed );
+    stats.Rejected = Rejected.load( std::memory_order_relaxed );
+    stats.Dropped  = Queue.GetDropped();
+    stats.Sent     = Sent;
+    stats.Deferred = Deferred;
+    return stats;
+  }
+};
+
+#endif  // TM_COMMAND_LISTENER_H
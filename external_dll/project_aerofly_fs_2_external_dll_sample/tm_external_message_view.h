@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_external_message_view.h - read messages in place from the received byte stream
+//
+// tm_external_message::GetFromByteStream copies every header and payload into a 128 byte object.
+// tm_external_message_view only points into the byte stream and reads the header fields and the
+// typed payload where they are. tm_external_message_stream iterates over all messages of a frame:
+//
+//   for( const auto message : tm_external_message_stream( byte_stream, size, num_messages ) ) { }
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_EXTERNAL_MESSAGE_VIEW_H
+#define TM_EXTERNAL_MESSAGE_VIEW_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <iterator>
+#include <stddef.h>
+#include <string.h>
+
+
+class tm_external_message_view
+{
+private:
+  const tm_uint8 *Message = nullptr;
+
+  // the byte stream has no alignment guarantees, memcpy compiles to a plain load
+  template<typename T> T Read( const size_t offset ) const
+  {
+    T value;
+    memcpy( &value, Message + offset, sizeof( T ) );
+    return value;
+  }
+
+  // a value of the payload. bytes beyond GetDataSize() read as 0, like the zero filled copy of
+  // tm_external_message::GetFromByteStream, instead of the next message or past the stream.
+  template<typename T> T ReadData( const tm_uint32 offset ) const
+  {
+    const tm_uint32 data_size = GetDataSize();
+    T               value{};
+    if( offset < data_size )
+    {
+      const tm_uint32 available = data_size - offset;
+      memcpy( &value, Message + sizeof( tm_msg_header ) + offset, available < sizeof( T ) ? available : sizeof( T ) );
+    }
+    return value;
+  }
+
+  double ReadDouble( const tm_uint32 i ) const { return ReadData<double>( i * sizeof( double ) ); }
+
+public:
+  constexpr tm_external_message_view() = default;
+  constexpr explicit tm_external_message_view( const tm_uint8 *message ) : Message{ message } { }
+
+  tm_msg_header    GetHeader()     const { return Read<tm_msg_header>( 0 ); }
+  tm_uint64        GetID()         const { return Read<tm_uint64>( offsetof( tm_msg_header, MessageID ) ); }
+  tm_string_hash   GetStringHash() const { return tm_string_hash( GetID() ); }
+  tm_msg_data_type GetDataType()   const { return Read<tm_msg_data_type>( offsetof( tm_msg_header, DataType ) ); }
+  tm_msg_flag_set  GetFlags()      const { return Read<tm_msg_flag_set>( offsetof( tm_msg_header, Flags ) ); }
+  tm_uint16        GetSize()       const { return Read<tm_uint16>( offsetof( tm_msg_header, MessageSize ) ); }
+  tm_uint8         GetPriority()   const { return Read<tm_uint8>( offsetof( tm_msg_header, PriorityTypeOfService ) ); }
+  tm_uint64        GetDeviceID()   const { return Read<tm_uint64>( offsetof( tm_msg_header, SenderID ) ); }
+  tm_uint8         GetDataCount()  const { return Read<tm_uint8>( offsetof( tm_msg_header, DataCount ) ); }
+  const tm_uint8  *GetDataPointer() const { return Message + sizeof( tm_msg_header ); }
+
+  // same clamping as tm_external_message::GetFromByteStream
+  tm_uint32 GetDataSize() const
+  {
+    const tm_uint32 size      = GetSize();
+    const tm_uint32 data_size = size > sizeof( tm_msg_header ) ? static_cast<tm_uint32>( size - sizeof( tm_msg_header ) ) : 0;
+    return data_size < tm_external_message::GetMaxDataSize() ? data_size : tm_external_message::GetMaxDataSize();
+  }
+
+  tm_int64 GetInt() const
+  {
+    assert( GetDataType() == tm_msg_data_type::Int );
+    return ReadData<tm_int64>( 0 );
+  }
+
+  double GetDouble() const
+  {
+    assert( GetDataType() == tm_msg_data_type::Double );
+    return ReadDouble( 0 );
+  }
+
+  tm_vector2d GetVector2d() const
+  {
+    assert( GetDataType() == tm_msg_data_type::Vector2d );
+    return { ReadDouble( 0 ), ReadDouble( 1 ) };
+  }
+
+  tm_vector3d GetVector3d() const
+  {
+    assert( GetDataType() == tm_msg_data_type::Vector3d );
+    return { ReadDouble( 0 ), ReadDouble( 1 ), ReadDouble( 2 ) };
+  }
+
+  tm_vector4d GetVector4d() const
+  {
+    assert( GetDataType() == tm_msg_data_type::Vector4d );
+    return { ReadDouble( 0 ), ReadDouble( 1 ), ReadDouble( 2 ), ReadDouble( 3 ) };
+  }
+
+  tm_string GetString() const
+  {
+    const auto data_type = GetDataType();
+    assert( data_type == tm_msg_data_type::String || data_type == tm_msg_data_type::String8 );
+
+    if( data_type == tm_msg_data_type::String )
+    {
+      tm_chartype chars[tm_external_message::GetMaxDataSize() / sizeof( tm_chartype )] = {};
+      memcpy( chars, GetDataPointer(), GetDataSize() );
+      return tm_string( chars, sizeof( chars ) / sizeof( chars[0] ) );
+    }
+    else if( data_type == tm_msg_data_type::String8 )
+    {
+      return tm_string( reinterpret_cast<const char*>( GetDataPointer() ), GetDataSize() );
+    }
+
+    return {};
+  }
+
+  // copies the message, for code that needs a tm_external_message
+  tm_external_message ToMessage() const
+  {
+    tm_uint32 pos = 0;
+    return tm_external_message::GetFromByteStream( Message, pos );
+  }
+
+  // number of bytes this message occupies in the byte stream
+  tm_uint32 GetStreamSize() const { return static_cast<tm_uint32>( sizeof( tm_msg_header ) ) + GetDataSize(); }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// forward iteration over the messages of one received byte stream
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_external_message_stream
+{
+private:
+  const tm_uint8 *ByteStream;
+  tm_uint32       ByteStreamSize;
+  tm_uint32       NumMessages;
+
+public:
+  class iterator
+  {
+  private:
+    const tm_uint8 *Position  = nullptr;
+    const tm_uint8 *End       = nullptr;
+    tm_uint32       Remaining = 0;
+
+    // stop early rather than reading past the stream if a header is cut off
+    void Validate()
+    {
+      if( Remaining == 0 || End - Position < static_cast<ptrdiff_t>( sizeof( tm_msg_header ) ) ||
+          End - Position < static_cast<ptrdiff_t>( tm_external_message_view( Position ).GetStreamSize() ) )
+      {
+        Remaining = 0;
+      }
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = tm_external_message_view;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const tm_external_message_view *;
+    using reference         = tm_external_message_view;
+
+    iterator() = default;
+    iterator( const tm_uint8 *position, const tm_uint8 *end, const tm_uint32 remaining ) : Position{ position }, End{ end }, Remaining{ remaining }
+    {
+      Validate();
+    }
+
+    tm_external_message_view operator*() const { return tm_external_message_view( Position ); }
+
+    iterator &operator++()
+    {
+      Position += tm_external_message_view( Position ).GetStreamSize();
+      --Remaining;
+      Validate();
+      return *this;
+    }
+
+    iterator operator++( int ) { iterator previous = *this; ++*this; return previous; }
+
+    bool operator==( const iterator &b ) const { return Remaining == b.Remaining; }
+    bool operator!=( const iterator &b ) const { return Remaining != b.Remaining; }
+  };
+
+  tm_external_message_stream( const tm_uint8 *byte_stream, const tm_uint32 byte_stream_size, const tm_uint32 num_messages )
+    : ByteStream{ byte_stream }, ByteStreamSize{ byte_stream_size }, NumMessages{ num_messages }
+  {
+  }
+
+  iterator begin() const { return iterator( ByteStream, ByteStream + ByteStreamSize, ByteStream != nullptr ? NumMessages : 0 ); }
+  iterator end()   const { return iterator( ByteStream + ByteStreamSize, ByteStream + ByteStreamSize, 0 ); }
+};
+
+#endif  // TM_EXTERNAL_MESSAGE_VIEW_H
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_frame_pacing.h - the delta_time of the simulation, its distribution and its stalls
+//
+// Every Update records delta_time into a histogram of the session and one of the current window,
+// one second of simulation time. The percentiles of the last complete window are the rolling
+// values, the worst of them is kept for the summary.
+//
+// An Update with a delta_time above the stall threshold is a stall: the simulation stood still
+// for that long and the values of its frame jump by as much. Update() reports it so the next frame
+// can carry tm_telemetry_frame_flag::Stall and filters downstream can hold or fade instead of
+// passing the jump on. A delta_time of 0 is a paused simulation and is counted, not recorded.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_FRAME_PACING_H
+#define TM_FRAME_PACING_H
+
+#include "tm_latency_histogram.h"
+#include "tm_platform.h"
+
+
+struct tm_frame_pacing_window
+{
+  tm_uint64 Frames = 0;
+  double    P50    = 0;     // seconds
+  double    P99    = 0;
+  double    Max    = 0;
+};
+
+struct tm_frame_pacing_stats
+{
+  tm_uint64 Frames         = 0;     // updates with a delta_time
+  tm_uint64 Paused         = 0;     // updates with a delta_time of 0
+  tm_uint64 Stalls         = 0;
+  double    StallTime      = 0;     // seconds, the sum of the stalled delta_times
+  double    LongestStall   = 0;     // seconds
+  double    LongestStallAt = 0;     // simulation time of the longest stall
+  double    WorstWindowP99 = 0;     // seconds
+};
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_frame_pacing_monitor - called on the simulation thread only
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_frame_pacing_monitor
+{
+private:
+  static constexpr tm_uint32 MaxLoggedStalls = 16;
+  static constexpr double    WindowLength    = 1;      // seconds of simulation time
+
+  tm_latency_snapshot    Session;
+  tm_latency_snapshot    Window;
+  double                 WindowTime     = 0;
+  double                 SimulationTime = 0;
+  double                 StallThreshold = 0;
+  tm_frame_pacing_window Rolling;
+  tm_frame_pacing_stats  Stats;
+
+  void FinishWindow()
+  {
+    Rolling.Frames = Window.Count;
+    Rolling.P50    = Window.GetPercentile( 50 ) * 1e-9;
+    Rolling.P99    = Window.GetPercentile( 99 ) * 1e-9;
+    Rolling.Max    = Window.Max * 1e-9;
+    Stats.WorstWindowP99 = Rolling.P99 > Stats.WorstWindowP99 ? Rolling.P99 : Stats.WorstWindowP99;
+
+    Window     = tm_latency_snapshot();
+    WindowTime = 0;
+  }
+
+public:
+  // 'stall_threshold' in seconds, 0 detects no stalls
+  void Reset( const double stall_threshold )
+  {
+    Session        = tm_latency_snapshot();
+    Window         = tm_latency_snapshot();
+    WindowTime     = 0;
+    SimulationTime = 0;
+    StallThreshold = stall_threshold;
+    Rolling        = tm_frame_pacing_window();
+    Stats          = tm_frame_pacing_stats();
+  }
+
+  //
+  // records the delta_time of one Update, returns true when it was a stall
+  //
+  bool Update( const double delta_time )
+  {
+    if( !( delta_time > 0 ) )
+    {
+      ++Stats.Paused;
+      return false;
+    }
+
+    const tm_uint64 delta_ns = static_cast<tm_uint64>( delta_time * 1e9 );
+    Session.Record( delta_ns );
+    Window.Record( delta_ns );
+    ++Stats.Frames;
+    SimulationTime += delta_time;
+
+    const bool stall = StallThreshold > 0 && delta_time > StallThreshold;
+    if( stall )
+    {
+      ++Stats.Stalls;
+      Stats.StallTime += delta_time;
+      if( delta_time > Stats.LongestStall )
+      {
+        Stats.LongestStall   = delta_time;
+        Stats.LongestStallAt = SimulationTime;
+      }
+
+      if( Stats.Stalls <= MaxLoggedStalls )
+      {
+        tm_platform_log( "stall of %.1f ms at %.1f s, the second before p50 %.1f ms, p99 %.1f ms", delta_time * 1e3, SimulationTime,
+                         Rolling.P50 * 1e3, Rolling.P99 * 1e3 );
+      }
+    }
+
+    WindowTime += delta_time;
+    if( WindowTime >= WindowLength ) { FinishWindow(); }
+    return stall;
+  }
+
+  // the last complete window
+  const tm_frame_pacing_window &GetRolling() const { return Rolling; }
+  const tm_frame_pacing_stats  &GetStats() const   { return Stats; }
+  const tm_latency_snapshot    &GetSession() const { return Session; }
+  double                        GetStallThreshold() const { return StallThreshold; }
+};
+
+#endif  // TM_FRAME_PACING_H
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_frame_recorder.h - records the received byte streams to a frame log
+//
+// The simulation thread copies the byte stream and a record header into a byte ring, a writer
+// thread appends the records to a memory-mapped file and keeps the sparse time index. The file
+// format is documented in shared/telemetry/tm_frame_log.h.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_FRAME_RECORDER_H
+#define TM_FRAME_RECORDER_H
+
+#include "../shared/telemetry/tm_frame_log.h"
+#include "tm_mapped_file.h"
+#include "tm_platform.h"
+#include "tm_spsc_byte_ring.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string.h>
+
+
+class tm_frame_recorder
+{
+private:
+  static constexpr tm_uint64 FileGrowSize = 64ull << 20;
+
+  tm_spsc_byte_ring                     Ring;
+  tm_mapped_file                        File;
+  std::thread                           Thread;
+  std::atomic<bool>                     Running{ false };
+  std::atomic<tm_uint64>                Recorded{ 0 };
+  std::chrono::steady_clock::time_point StartTime;
+  const tm_uint8                        Empty[1] = {};
+
+  // writer thread only
+  tm_frame_log_header                   Header;
+  std::vector<tm_frame_log_index_entry> Index;
+  std::vector<tm_uint8>                 Buffer;
+  bool                                  Failed = false;
+
+  bool Reserve( const tm_uint64 size )
+  {
+    if( Header.DataEnd + size <= File.GetSize() ) { return true; }
+
+    tm_uint64 file_size = File.GetSize();
+    while( Header.DataEnd + size > file_size ) { file_size += FileGrowSize; }
+
+    if( File.Resize( file_size ) ) { return true; }
+
+    tm_platform_log( "recording stopped, the file could not be enlarged to %llu bytes", static_cast<unsigned long long>( file_size ) );
+    Failed = true;
+    return false;
+  }
+
+  // appends one record and publishes it in the file header
+  void Append( const tm_frame_log_record &record, const void *payload )
+  {
+    const tm_uint64 record_size = tm_frame_log_record_size( record.Size );
+    if( Failed || !Reserve( record_size ) ) { return; }
+
+    tm_uint8 *p = File.GetData() + Header.DataEnd;
+    memcpy( p, &record, sizeof( record ) );
+    if( record.Size > 0 ) { memcpy( p + sizeof( record ), payload, record.Size ); }
+    memset( p + sizeof( record ) + record.Size, 0, static_cast<size_t>( record_size - sizeof( record ) - record.Size ) );
+
+    if( record.Type == tm_frame_log_record_type::Frame )
+    {
+      if( Index.empty() || record.Timestamp >= Index.back().Timestamp + tm_frame_log_index_interval )
+      {
+        Index.push_back( { record.Timestamp, Header.NumFrames, Header.DataEnd } );
+      }
+      ++Header.NumFrames;
+    }
+
+    Header.DataEnd += record_size;
+    memcpy( File.GetData(), &Header, sizeof( Header ) );
+  }
+
+  void Run()
+  {
+    for( ;; )
+    {
+      const tm_uint32 signal = Ring.GetSignal();
+
+      tm_uint32 size = 0;
+      while( Ring.Peek( size ) )
+      {
+        if( Buffer.size() < size ) { Buffer.resize( size ); }
+        Ring.Pop( Buffer.data(), size );
+
+        tm_frame_log_record record;
+        memcpy( &record, Buffer.data(), sizeof( record ) );
+        Append( record, Buffer.data() + sizeof( record ) );
+      }
+
+      if( !Running.load( std::memory_order_acquire ) ) { break; }
+
+      Ring.WaitForData( signal );
+    }
+
+    // the index goes last, a reader finds it through the header
+    tm_frame_log_record record;
+    record.Type = tm_frame_log_record_type::Index;
+    record.Size = static_cast<tm_uint32>( Index.size() * sizeof( tm_frame_log_index_entry ) );
+
+    const tm_uint64 index_offset = Header.DataEnd;
+    Append( record, Index.data() );
+    if( !Failed )
+    {
+      Header.IndexOffset = index_offset;
+      memcpy( File.GetData(), &Header, sizeof( Header ) );
+    }
+  }
+
+public:
+  tm_frame_recorder() = default;
+  tm_frame_recorder( const tm_frame_recorder & ) = delete;
+  tm_frame_recorder &operator=( const tm_frame_recorder & ) = delete;
+  ~tm_frame_recorder() { Stop(); }
+
+  //
+  // creates the file and starts the writer thread. 'buffer_size' bytes are buffered between the
+  // simulation and the writer thread, frames that do not fit are dropped.
+  //
+  bool Start( const char *path, const tm_uint64 buffer_size )
+  {
+    Stop();
+
+    if( !File.Create( path, FileGrowSize ) )
+    {
+      tm_platform_log( "cannot create recording '%s'", path );
+      return false;
+    }
+
+    Ring.Reset( buffer_size );
+    Recorded.store( 0, std::memory_order_relaxed );
+    StartTime = std::chrono::steady_clock::now();
+
+    Header           = tm_frame_log_header();
+    Header.StartTime = static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::system_clock::now().time_since_epoch() ).count() );
+    memcpy( File.GetData(), &Header, sizeof( Header ) );
+
+    Index.clear();
+    Failed = false;
+
+    Running.store( true, std::memory_order_release );
+    Thread = std::thread( &tm_frame_recorder::Run, this );
+    return true;
+  }
+
+  //
+  // writes the remaining frames and the index and closes the file
+  //
+  void Stop()
+  {
+    if( !Thread.joinable() ) { return; }
+
+    Running.store( false, std::memory_order_release );
+    Ring.Wake();
+    Thread.join();
+
+    File.Close( Header.DataEnd );
+  }
+
+  bool IsRecording() const { return Running.load( std::memory_order_relaxed ); }
+
+  //
+  // called on the simulation thread with the arguments of Update, copies the byte stream and
+  // never blocks. 'time' is when Update was called.
+  //
+  bool Record( const std::chrono::steady_clock::time_point time, const tm_double delta_time,
+               const tm_uint8 *byte_stream, const tm_uint32 byte_stream_size, const tm_uint32 num_messages )
+  {
+    tm_frame_log_record record;
+    record.Size        = byte_stream != nullptr ? byte_stream_size : 0;
+    record.Timestamp   = static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( time - StartTime ).count() );
+    record.DeltaTime   = delta_time;
+    record.NumMessages = num_messages;
+
+    if( !Ring.Push( &record, sizeof( record ), byte_stream != nullptr ? byte_stream : Empty, record.Size ) ) { return false; }
+
+    Recorded.fetch_add( 1, std::memory_order_relaxed );
+    return true;
+  }
+
+  tm_uint64 GetRecorded() const { return Recorded.load( std::memory_order_relaxed ); }
+  tm_uint64 GetDropped()  const { return Ring.GetDropped(); }
+};
+
+#endif  // TM_FRAME_RECORDER_H
@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_latency_histogram.h - log-linear histogram of durations, one writer and any readers
+//
+// The buckets follow the layout of HDR histograms: values below 64 have a bucket each, above
+// that every power of two is split into 32 buckets, which keeps the relative error below 1.6%
+// from 1 ns up to 2^40 ns (18 minutes) in 1184 buckets. Larger values go into the last bucket.
+//
+// Record() is meant for a single thread and does not use read-modify-write instructions. Other
+// threads read the counts at any time with Snapshot(), a snapshot taken while a value is recorded
+// may miss that value but never sees a count go backwards.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_LATENCY_HISTOGRAM_H
+#define TM_LATENCY_HISTOGRAM_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <atomic>
+#include <bit>
+
+
+constexpr tm_uint32 tm_latency_histogram_sub_buckets = 32;
+constexpr tm_uint32 tm_latency_histogram_max_shift   = 35;
+constexpr tm_uint32 tm_latency_histogram_buckets     = 2 * tm_latency_histogram_sub_buckets + tm_latency_histogram_max_shift * tm_latency_histogram_sub_buckets;
+
+constexpr tm_uint32 tm_latency_histogram_get_bucket( const tm_uint64 value )
+{
+  if( value < 2 * tm_latency_histogram_sub_buckets ) { return static_cast<tm_uint32>( value ); }
+
+  const tm_uint32 shift = static_cast<tm_uint32>( std::bit_width( value ) ) - 6;
+  if( shift > tm_latency_histogram_max_shift ) { return tm_latency_histogram_buckets - 1; }
+  return 2 * tm_latency_histogram_sub_buckets + ( shift - 1 ) * tm_latency_histogram_sub_buckets + static_cast<tm_uint32>( ( value >> shift ) - tm_latency_histogram_sub_buckets );
+}
+
+// the middle of the values that fall into the bucket
+constexpr double tm_latency_histogram_get_value( const tm_uint32 bucket )
+{
+  if( bucket < 2 * tm_latency_histogram_sub_buckets ) { return bucket; }
+
+  const tm_uint32 shift    = ( bucket - 2 * tm_latency_histogram_sub_buckets ) / tm_latency_histogram_sub_buckets + 1;
+  const tm_uint64 mantissa = ( bucket - 2 * tm_latency_histogram_sub_buckets ) % tm_latency_histogram_sub_buckets + tm_latency_histogram_sub_buckets;
+  return ( static_cast<double>( mantissa ) + 0.5 ) * static_cast<double>( tm_uint64( 1 ) << shift );
+}
+
+static_assert( tm_latency_histogram_get_bucket( 63 ) == 63 && tm_latency_histogram_get_bucket( 64 ) == 64, "histogram buckets are not contiguous" );
+static_assert( tm_latency_histogram_get_bucket( ( tm_uint64( 1 ) << 41 ) - 1 ) == tm_latency_histogram_buckets - 1, "histogram range does not match its bucket count" );
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the counts of a histogram at one point in time, snapshots subtract to get an interval
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+struct tm_latency_snapshot
+{
+  tm_uint64 Counts[tm_latency_histogram_buckets] = {};
+  tm_uint64 Count = 0;
+  tm_uint64 Max   = 0;
+  tm_uint64 Sum   = 0;
+
+  // counts without a histogram, for values that are recorded and read on the same thread
+  void Record( const tm_uint64 value )
+  {
+    ++Counts[tm_latency_histogram_get_bucket( value )];
+    ++Count;
+    Sum += value;
+    Max  = value > Max ? value : Max;
+  }
+
+  void Subtract( const tm_latency_snapshot &earlier )
+  {
+    for( tm_uint32 i = 0; i < tm_latency_histogram_buckets; ++i ) { Counts[i] -= earlier.Counts[i]; }
+    Count -= earlier.Count;
+    Sum   -= earlier.Sum;
+  }
+
+  double GetMean() const { return Count > 0 ? static_cast<double>( Sum ) / Count : 0; }
+
+  // 'percentile' from 0 to 100, 0 without values
+  double GetPercentile( const double percentile ) const
+  {
+    if( Count == 0 ) { return 0; }
+
+    const tm_uint64 rank = static_cast<tm_uint64>( percentile / 100 * static_cast<double>( Count - 1 ) ) + 1;
+    tm_uint64       seen = 0;
+    for( tm_uint32 i = 0; i < tm_latency_histogram_buckets; ++i )
+    {
+      seen += Counts[i];
+      if( seen >= rank ) { return tm_latency_histogram_get_value( i ); }
+    }
+
+    return tm_latency_histogram_get_value( tm_latency_histogram_buckets - 1 );
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_latency_histogram
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_latency_histogram
+{
+private:
+  std::atomic<tm_uint64> Counts[tm_latency_histogram_buckets] = {};
+  std::atomic<tm_uint64> Count{ 0 };
+  std::atomic<tm_uint64> Max{ 0 };
+  std::atomic<tm_uint64> Sum{ 0 };
+
+  // the only writer, a plain load and store instead of a locked add
+  static void Add( std::atomic<tm_uint64> &counter, const tm_uint64 value )
+  {
+    counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+  }
+
+public:
+  // not thread safe
+  void Reset()
+  {
+    for( auto &count : Counts ) { count.store( 0, std::memory_order_relaxed ); }
+    Count.store( 0, std::memory_order_relaxed );
+    Max.store( 0, std::memory_order_relaxed );
+    Sum.store( 0, std::memory_order_relaxed );
+  }
+
+  void Record( const tm_uint64 value )
+  {
+    Add( Counts[tm_latency_histogram_get_bucket( value )], 1 );
+    Add( Sum, value );
+    if( value > Max.load( std::memory_order_relaxed ) ) { Max.store( value, std::memory_order_relaxed ); }
+    Count.store( Count.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+  }
+
+  tm_uint64 GetCount() const { return Count.load( std::memory_order_acquire ); }
+
+  void Snapshot( tm_latency_snapshot &snapshot ) const
+  {
+    snapshot.Count = 0;
+    for( tm_uint32 i = 0; i < tm_latency_histogram_buckets; ++i )
+    {
+      snapshot.Counts[i] = Counts[i].load( std::memory_order_relaxed );
+      snapshot.Count    += snapshot.Counts[i];
+    }
+
+    snapshot.Max = Max.load( std::memory_order_relaxed );
+    snapshot.Sum = Sum.load( std::memory_order_relaxed );
+  }
+};
+
+#endif  // TM_LATENCY_HISTOGRAM_H
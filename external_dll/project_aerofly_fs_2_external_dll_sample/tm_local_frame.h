@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_local_frame.h - cached east/north/up basis at the aircraft position
+//
+// tmcoordinates_GetUpAt, GetEastAt and GetNorthAt normalize two vectors and take a cross product
+// on every call. Between two frames the aircraft moves a few meters at most and the basis does
+// not change measurably, so tm_local_frame keeps the basis of the last position it was computed
+// at and only computes it again when the aircraft moved more than a threshold away from there.
+//
+// Up tilts by one radian per earth radius moved, east and north additionally turn about up by
+// tan( latitude ) radians per earth radius moved east. The threshold is therefore scaled with
+// cos( latitude ) at the position the basis was computed at, which bounds the rotation of a
+// vector to about threshold / 6.33e6 radians everywhere, e.g. 1.6e-5 for the default 100 m:
+// 0.004 m/s of a 250 m/s velocity. Close to the poles the basis is computed more often.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_LOCAL_FRAME_H
+#define TM_LOCAL_FRAME_H
+
+#include "../shared/input/tm_external_message.h"
+
+
+enum class tm_local_frame_axes : tm_uint8
+{
+  ENU,      // x east,  y north, z up
+  NED       // x north, y east,  z down
+};
+
+class tm_local_frame
+{
+private:
+  tm_vector3d Origin;               // the position the basis was computed at
+  tm_vector3d East;
+  tm_vector3d North;
+  tm_vector3d Up;
+  double      ThresholdSquared = 100.0 * 100.0;
+  double      LimitSquared     = 0;        // ThresholdSquared scaled by cos( latitude )^2 at Origin
+  tm_uint64   NumComputed      = 0;
+  bool        Valid            = false;
+
+public:
+  void SetThreshold( const double meters ) { ThresholdSquared = meters * meters; }
+
+  bool      IsValid()        const { return Valid; }
+  tm_uint64 GetNumComputed() const { return NumComputed; }
+
+  const tm_vector3d &GetEast()  const { return East; }
+  const tm_vector3d &GetNorth() const { return North; }
+  const tm_vector3d &GetUp()    const { return Up; }
+
+  //
+  // moves the frame to the global position, returns true if the basis was computed again
+  //
+  bool Update( const tm_vector3d &position )
+  {
+    const tm_vector3d d = position - Origin;
+    if( Valid && d.x * d.x + d.y * d.y + d.z * d.z <= LimitSquared ) { return false; }
+
+    // the same as the helpers, with up computed once
+    Origin = position;
+    Up     = tmcoordinates_GetUpAt( position );
+    East   = tmcoordinates_GetEastAt( position );
+    North  = CrossProduct( Up, East );
+    Valid  = true;
+
+    // the horizontal part of up is cos( latitude )
+    LimitSquared = ThresholdSquared * ( Up.x * Up.x + Up.y * Up.y );
+    ++NumComputed;
+    return true;
+  }
+
+  tm_vector3d ToLocal( const tm_vector3d &v, const tm_local_frame_axes axes ) const
+  {
+    const double e = East.x * v.x + East.y * v.y + East.z * v.z;
+    const double n = North.x * v.x + North.y * v.y + North.z * v.z;
+    const double u = Up.x * v.x + Up.y * v.y + Up.z * v.z;
+    return axes == tm_local_frame_axes::ENU ? tm_vector3d( e, n, u ) : tm_vector3d( n, e, -u );
+  }
+
+  //
+  // converts 'count' global vectors, 'local' may be the same array as 'global'. the vectors are
+  // 'stride' doubles apart, 3 for a packed array of tm_vector3d.
+  //
+  void ToLocal( const double *global, double *local, const tm_uint32 count, const tm_uint32 stride, const tm_local_frame_axes axes ) const
+  {
+    // the rows of the rotation, in the order of the output axes
+    const bool        enu = axes == tm_local_frame_axes::ENU;
+    const tm_vector3d r0  = enu ? East : North;
+    const tm_vector3d r1  = enu ? North : East;
+    const tm_vector3d r2  = enu ? Up : Up * -1.0;
+
+    for( tm_uint32 i = 0; i < count; ++i )
+    {
+      const double x = global[i * stride + 0];
+      const double y = global[i * stride + 1];
+      const double z = global[i * stride + 2];
+      local[i * stride + 0] = r0.x * x + r0.y * y + r0.z * z;
+      local[i * stride + 1] = r1.x * x + r1.y * y + r1.z * z;
+      local[i * stride + 2] = r2.x * x + r2.y * y + r2.z * z;
+    }
+  }
+};
+
+#endif  // TM_LOCAL_FRAME_H
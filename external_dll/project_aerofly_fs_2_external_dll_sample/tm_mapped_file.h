@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_mapped_file.h - a file that is written through a memory mapping
+//
+// The file is created empty, Resize() grows it and maps it again, Close() cuts it to the number
+// of bytes that were actually written. Pointers returned by GetData() are invalid after Resize().
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_MAPPED_FILE_H
+#define TM_MAPPED_FILE_H
+
+#include "tm_platform.h"
+#include "../shared/input/tm_external_message.h"
+
+#if !TM_PLATFORM_WINDOWS
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+
+class tm_mapped_file
+{
+private:
+#if TM_PLATFORM_WINDOWS
+  HANDLE    File    = INVALID_HANDLE_VALUE;
+  HANDLE    Mapping = nullptr;
+#else
+  int       File    = -1;
+#endif
+  tm_uint8 *Data    = nullptr;
+  tm_uint64 Size    = 0;
+
+  void Unmap()
+  {
+#if TM_PLATFORM_WINDOWS
+    if( Data != nullptr )    { UnmapViewOfFile( Data ); }
+    if( Mapping != nullptr ) { CloseHandle( Mapping ); }
+    Mapping = nullptr;
+#else
+    if( Data != nullptr ) { munmap( Data, Size ); }
+#endif
+    Data = nullptr;
+  }
+
+  bool SetFileSize( const tm_uint64 size )
+  {
+#if TM_PLATFORM_WINDOWS
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>( size );
+    return SetFilePointerEx( File, position, nullptr, FILE_BEGIN ) && SetEndOfFile( File );
+#else
+    return ftruncate( File, static_cast<off_t>( size ) ) == 0;
+#endif
+  }
+
+public:
+  tm_mapped_file() = default;
+  tm_mapped_file( const tm_mapped_file & ) = delete;
+  tm_mapped_file &operator=( const tm_mapped_file & ) = delete;
+  ~tm_mapped_file() { Close( Size ); }
+
+  bool      IsOpen()  const { return Data != nullptr; }
+  tm_uint8 *GetData() const { return Data; }
+  tm_uint64 GetSize() const { return Size; }
+
+  //
+  // creates or truncates the file and maps the first 'size' bytes
+  //
+  bool Create( const char *path, const tm_uint64 size )
+  {
+    Close( Size );
+
+#if TM_PLATFORM_WINDOWS
+    File = CreateFileA( path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( File == INVALID_HANDLE_VALUE ) { return false; }
+#else
+    File = open( path, O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if( File < 0 ) { return false; }
+#endif
+
+    if( !Resize( size ) )
+    {
+      Close( 0 );
+      return false;
+    }
+
+    return true;
+  }
+
+  //
+  // changes the size of the file and maps all of it again
+  //
+  bool Resize( const tm_uint64 size )
+  {
+    Unmap();
+    Size = 0;
+
+    if( size == 0 || !SetFileSize( size ) ) { return false; }
+
+#if TM_PLATFORM_WINDOWS
+    Mapping = CreateFileMappingA( File, nullptr, PAGE_READWRITE, static_cast<DWORD>( size >> 32 ), static_cast<DWORD>( size ), nullptr );
+    if( Mapping == nullptr ) { return false; }
+
+    Data = static_cast<tm_uint8*>( MapViewOfFile( Mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>( size ) ) );
+    if( Data == nullptr ) { Unmap(); return false; }
+#else
+    void *data = mmap( nullptr, static_cast<size_t>( size ), PROT_READ | PROT_WRITE, MAP_SHARED, File, 0 );
+    if( data == MAP_FAILED ) { return false; }
+    Data = static_cast<tm_uint8*>( data );
+#endif
+
+    Size = size;
+    return true;
+  }
+
+  //
+  // unmaps the file and cuts it to 'final_size' bytes
+  //
+  void Close( const tm_uint64 final_size )
+  {
+    Unmap();
+
+#if TM_PLATFORM_WINDOWS
+    if( File != INVALID_HANDLE_VALUE )
+    {
+      SetFileSize( final_size );
+      CloseHandle( File );
+      File = INVALID_HANDLE_VALUE;
+    }
+#else
+    if( File >= 0 )
+    {
+      SetFileSize( final_size );
+      close( File );
+      File = -1;
+    }
+#endif
+
+    Size = 0;
+  }
+};
+
+#endif  // TM_MAPPED_FILE_H
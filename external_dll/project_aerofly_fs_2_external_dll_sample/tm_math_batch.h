@@ -0,0 +1,305 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_math_batch.h - the vector math of tm_external_message.h over whole arrays
+//
+// The math types of tm_external_message.h hold one value each. Replaying a session or deriving
+// channels over a recording applies the same operation to thousands of samples, which these
+// kernels do on structure-of-arrays data, one array per component:
+//
+//   tm_batch_rotate                   out[i] = m[i] * v[i]                  tm_matrix3d * tm_vector3d
+//   tm_batch_rotate_uniform           out[i] = m * v[i]
+//   tm_batch_quaternion_to_matrix     m[i]   = tm_QuaternionToMatrix( q[i] )
+//   tm_batch_normalize                out[i] = Normalized( v[i] )
+//
+// Each kernel has a scalar version, which calls the templates themselves, an SSE2 version with two
+// samples per instruction and an AVX2 version with four. The best one the cpu supports is chosen
+// once at runtime. The vector versions do the same operations in the same order as the templates
+// and do not fuse multiplies and adds, so their results match the scalar ones bit for bit on
+// compilers that do not contract the templates either. Outputs may alias inputs of the same
+// component.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_MATH_BATCH_H
+#define TM_MATH_BATCH_H
+
+#include "../shared/input/tm_external_message.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+  #define TM_BATCH_X64 1
+  #include <immintrin.h>
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define TM_BATCH_TARGET_AVX2
+  #else
+    #define TM_BATCH_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+  #endif
+#else
+  #define TM_BATCH_X64 0
+#endif
+
+
+//
+// views of the component arrays, the caller owns the memory
+//
+struct tm_vector3d_soa
+{
+  double *x;
+  double *y;
+  double *z;
+};
+
+struct tm_quaterniond_soa
+{
+  double *r;
+  double *x;
+  double *y;
+  double *z;
+};
+
+struct tm_matrix3d_soa
+{
+  double *xx, *xy, *xz;
+  double *yx, *yy, *yz;
+  double *zx, *zy, *zz;
+};
+
+enum class tm_batch_isa : tm_uint8
+{
+  Scalar,
+  SSE2,
+  AVX2
+};
+
+constexpr const char *tm_batch_isa_names[] = { "scalar", "sse2", "avx2" };
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// scalar kernels, the templates applied to every sample, also the tails of the vector kernels
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+inline void tm_batch_rotate_scalar( const tm_matrix3d_soa &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 first, const tm_uint32 count )
+{
+  for( tm_uint32 i = first; i < count; ++i )
+  {
+    tm_matrix3d matrix;
+    matrix.xx = m.xx[i]; matrix.xy = m.xy[i]; matrix.xz = m.xz[i];
+    matrix.yx = m.yx[i]; matrix.yy = m.yy[i]; matrix.yz = m.yz[i];
+    matrix.zx = m.zx[i]; matrix.zy = m.zy[i]; matrix.zz = m.zz[i];
+
+    const tm_vector3d r = matrix * tm_vector3d( v.x[i], v.y[i], v.z[i] );
+    out.x[i] = r.x;
+    out.y[i] = r.y;
+    out.z[i] = r.z;
+  }
+}
+
+inline void tm_batch_rotate_uniform_scalar( const tm_matrix3d &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 first, const tm_uint32 count )
+{
+  for( tm_uint32 i = first; i < count; ++i )
+  {
+    const tm_vector3d r = m * tm_vector3d( v.x[i], v.y[i], v.z[i] );
+    out.x[i] = r.x;
+    out.y[i] = r.y;
+    out.z[i] = r.z;
+  }
+}
+
+inline void tm_batch_quaternion_to_matrix_scalar( const tm_quaterniond_soa &q, const tm_matrix3d_soa &m, const tm_uint32 first, const tm_uint32 count )
+{
+  for( tm_uint32 i = first; i < count; ++i )
+  {
+    const tm_matrix3d r = tm_QuaternionToMatrix( tm_quaterniond( q.r[i], q.x[i], q.y[i], q.z[i] ) );
+    m.xx[i] = r.xx; m.xy[i] = r.xy; m.xz[i] = r.xz;
+    m.yx[i] = r.yx; m.yy[i] = r.yy; m.yz[i] = r.yz;
+    m.zx[i] = r.zx; m.zy[i] = r.zy; m.zz[i] = r.zz;
+  }
+}
+
+inline void tm_batch_normalize_scalar( const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 first, const tm_uint32 count )
+{
+  for( tm_uint32 i = first; i < count; ++i )
+  {
+    const tm_vector3d r = Normalized( tm_vector3d( v.x[i], v.y[i], v.z[i] ) );
+    out.x[i] = r.x;
+    out.y[i] = r.y;
+    out.z[i] = r.z;
+  }
+}
+
+
+
+
+#if TM_BATCH_X64
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the vector kernels are written once for both widths, W is one register of doubles
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#define TM_BATCH_DEFINE_KERNELS( SUFFIX, TARGET, W, WIDTH, LOAD, STORE, SET1, ADD, SUB, MUL, DIV, SQRT )                             \
+                                                                                                                                       \
+TARGET inline void tm_batch_rotate_##SUFFIX( const tm_matrix3d_soa &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out,            \
+                                             const tm_uint32 count )                                                                   \
+{                                                                                                                                      \
+  tm_uint32 i = 0;                                                                                                                     \
+  for( ; i + WIDTH <= count; i += WIDTH )                                                                                              \
+  {                                                                                                                                    \
+    const W x = LOAD( v.x + i ), y = LOAD( v.y + i ), z = LOAD( v.z + i );                                                             \
+    const W rx = ADD( ADD( MUL( LOAD( m.xx + i ), x ), MUL( LOAD( m.xy + i ), y ) ), MUL( LOAD( m.xz + i ), z ) );                     \
+    const W ry = ADD( ADD( MUL( LOAD( m.yx + i ), x ), MUL( LOAD( m.yy + i ), y ) ), MUL( LOAD( m.yz + i ), z ) );                     \
+    const W rz = ADD( ADD( MUL( LOAD( m.zx + i ), x ), MUL( LOAD( m.zy + i ), y ) ), MUL( LOAD( m.zz + i ), z ) );                     \
+    STORE( out.x + i, rx );                                                                                                            \
+    STORE( out.y + i, ry );                                                                                                            \
+    STORE( out.z + i, rz );                                                                                                            \
+  }                                                                                                                                    \
+  tm_batch_rotate_scalar( m, v, out, i, count );                                                                                       \
+}                                                                                                                                      \
+                                                                                                                                       \
+TARGET inline void tm_batch_rotate_uniform_##SUFFIX( const tm_matrix3d &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out,        \
+                                                     const tm_uint32 count )                                                           \
+{                                                                                                                                      \
+  const W xx = SET1( m.xx ), xy = SET1( m.xy ), xz = SET1( m.xz );                                                                     \
+  const W yx = SET1( m.yx ), yy = SET1( m.yy ), yz = SET1( m.yz );                                                                     \
+  const W zx = SET1( m.zx ), zy = SET1( m.zy ), zz = SET1( m.zz );                                                                     \
+  tm_uint32 i = 0;                                                                                                                     \
+  for( ; i + WIDTH <= count; i += WIDTH )                                                                                              \
+  {                                                                                                                                    \
+    const W x = LOAD( v.x + i ), y = LOAD( v.y + i ), z = LOAD( v.z + i );                                                             \
+    const W rx = ADD( ADD( MUL( xx, x ), MUL( xy, y ) ), MUL( xz, z ) );                                                               \
+    const W ry = ADD( ADD( MUL( yx, x ), MUL( yy, y ) ), MUL( yz, z ) );                                                               \
+    const W rz = ADD( ADD( MUL( zx, x ), MUL( zy, y ) ), MUL( zz, z ) );                                                               \
+    STORE( out.x + i, rx );                                                                                                            \
+    STORE( out.y + i, ry );                                                                                                            \
+    STORE( out.z + i, rz );                                                                                                            \
+  }                                                                                                                                    \
+  tm_batch_rotate_uniform_scalar( m, v, out, i, count );                                                                               \
+}                                                                                                                                      \
+                                                                                                                                       \
+TARGET inline void tm_batch_quaternion_to_matrix_##SUFFIX( const tm_quaterniond_soa &q, const tm_matrix3d_soa &m, const tm_uint32 count ) \
+{                                                                                                                                      \
+  const W one = SET1( 1.0 ), two = SET1( 2.0 );                                                                                        \
+  tm_uint32 i = 0;                                                                                                                     \
+  for( ; i + WIDTH <= count; i += WIDTH )                                                                                              \
+  {                                                                                                                                    \
+    const W r = LOAD( q.r + i ), x = LOAD( q.x + i ), y = LOAD( q.y + i ), z = LOAD( q.z + i );                                        \
+    STORE( m.xx + i, SUB( one, MUL( two, ADD( MUL( y, y ), MUL( z, z ) ) ) ) );                                                        \
+    STORE( m.xy + i, MUL( two, SUB( MUL( x, y ), MUL( r, z ) ) ) );                                                                    \
+    STORE( m.xz + i, MUL( two, ADD( MUL( x, z ), MUL( r, y ) ) ) );                                                                    \
+    STORE( m.yx + i, MUL( two, ADD( MUL( x, y ), MUL( r, z ) ) ) );                                                                    \
+    STORE( m.yy + i, SUB( one, MUL( two, ADD( MUL( x, x ), MUL( z, z ) ) ) ) );                                                        \
+    STORE( m.yz + i, MUL( two, SUB( MUL( y, z ), MUL( r, x ) ) ) );                                                                    \
+    STORE( m.zx + i, MUL( two, SUB( MUL( x, z ), MUL( r, y ) ) ) );                                                                    \
+    STORE( m.zy + i, MUL( two, ADD( MUL( y, z ), MUL( r, x ) ) ) );                                                                    \
+    STORE( m.zz + i, SUB( one, MUL( two, ADD( MUL( x, x ), MUL( y, y ) ) ) ) );                                                        \
+  }                                                                                                                                    \
+  tm_batch_quaternion_to_matrix_scalar( q, m, i, count );                                                                              \
+}                                                                                                                                      \
+                                                                                                                                       \
+TARGET inline void tm_batch_normalize_##SUFFIX( const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count )           \
+{                                                                                                                                      \
+  tm_uint32 i = 0;                                                                                                                     \
+  for( ; i + WIDTH <= count; i += WIDTH )                                                                                              \
+  {                                                                                                                                    \
+    const W x = LOAD( v.x + i ), y = LOAD( v.y + i ), z = LOAD( v.z + i );                                                             \
+    const W norm = SQRT( ADD( ADD( MUL( x, x ), MUL( y, y ) ), MUL( z, z ) ) );                                                        \
+    STORE( out.x + i, DIV( x, norm ) );                                                                                                \
+    STORE( out.y + i, DIV( y, norm ) );                                                                                                \
+    STORE( out.z + i, DIV( z, norm ) );                                                                                                \
+  }                                                                                                                                    \
+  tm_batch_normalize_scalar( v, out, i, count );                                                                                       \
+}
+
+TM_BATCH_DEFINE_KERNELS( sse2, , __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_div_pd, _mm_sqrt_pd )
+TM_BATCH_DEFINE_KERNELS( avx2, TM_BATCH_TARGET_AVX2, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_add_pd, _mm256_sub_pd,
+                         _mm256_mul_pd, _mm256_div_pd, _mm256_sqrt_pd )
+
+#undef TM_BATCH_DEFINE_KERNELS
+
+#endif  // TM_BATCH_X64
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// runtime dispatch
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+inline tm_batch_isa tm_batch_detect_isa()
+{
+#if TM_BATCH_X64 && defined(_MSC_VER) && !defined(__clang__)
+  // avx2 needs the cpu flag and the os saving the ymm registers
+  int info[4] = {};
+  __cpuid( info, 1 );
+  const bool osxsave = ( info[2] & ( 1 << 27 ) ) != 0 && ( info[2] & ( 1 << 28 ) ) != 0;
+  __cpuidex( info, 7, 0 );
+  const bool avx2 = osxsave && ( info[1] & ( 1 << 5 ) ) != 0 && ( _xgetbv( 0 ) & 6 ) == 6;
+  return avx2 ? tm_batch_isa::AVX2 : tm_batch_isa::SSE2;
+#elif TM_BATCH_X64
+  return __builtin_cpu_supports( "avx2" ) ? tm_batch_isa::AVX2 : tm_batch_isa::SSE2;
+#else
+  return tm_batch_isa::Scalar;
+#endif
+}
+
+struct tm_batch_kernels
+{
+  tm_batch_isa Isa;
+  void ( *Rotate )( const tm_matrix3d_soa &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count );
+  void ( *RotateUniform )( const tm_matrix3d &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count );
+  void ( *QuaternionToMatrix )( const tm_quaterniond_soa &q, const tm_matrix3d_soa &m, const tm_uint32 count );
+  void ( *Normalize )( const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count );
+};
+
+//
+// the kernels of 'isa', or of the best one below it that this build and cpu support
+//
+inline tm_batch_kernels tm_batch_get_kernels( const tm_batch_isa isa )
+{
+  const tm_batch_isa supported = tm_batch_detect_isa();
+  const tm_batch_isa selected  = isa < supported ? isa : supported;
+
+#if TM_BATCH_X64
+  if( selected == tm_batch_isa::AVX2 ) { return { selected, tm_batch_rotate_avx2, tm_batch_rotate_uniform_avx2, tm_batch_quaternion_to_matrix_avx2, tm_batch_normalize_avx2 }; }
+  if( selected == tm_batch_isa::SSE2 ) { return { selected, tm_batch_rotate_sse2, tm_batch_rotate_uniform_sse2, tm_batch_quaternion_to_matrix_sse2, tm_batch_normalize_sse2 }; }
+#endif
+
+  return { tm_batch_isa::Scalar,
+           []( const tm_matrix3d_soa &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count ) { tm_batch_rotate_scalar( m, v, out, 0, count ); },
+           []( const tm_matrix3d &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count ) { tm_batch_rotate_uniform_scalar( m, v, out, 0, count ); },
+           []( const tm_quaterniond_soa &q, const tm_matrix3d_soa &m, const tm_uint32 count ) { tm_batch_quaternion_to_matrix_scalar( q, m, 0, count ); },
+           []( const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count ) { tm_batch_normalize_scalar( v, out, 0, count ); } };
+}
+
+// the best kernels of this machine, looked up on the first call
+inline const tm_batch_kernels &tm_batch_get_kernels()
+{
+  static const tm_batch_kernels kernels = tm_batch_get_kernels( tm_batch_isa::AVX2 );
+  return kernels;
+}
+
+inline void tm_batch_rotate( const tm_matrix3d_soa &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count )
+{
+  tm_batch_get_kernels().Rotate( m, v, out, count );
+}
+
+inline void tm_batch_rotate_uniform( const tm_matrix3d &m, const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count )
+{
+  tm_batch_get_kernels().RotateUniform( m, v, out, count );
+}
+
+inline void tm_batch_quaternion_to_matrix( const tm_quaterniond_soa &q, const tm_matrix3d_soa &m, const tm_uint32 count )
+{
+  tm_batch_get_kernels().QuaternionToMatrix( q, m, count );
+}
+
+inline void tm_batch_normalize( const tm_vector3d_soa &v, const tm_vector3d_soa &out, const tm_uint32 count )
+{
+  tm_batch_get_kernels().Normalize( v, out, count );
+}
+
+#endif  // TM_MATH_BATCH_H
@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_message_catalog.h - compile-time catalog of all messages in MESSAGE_LIST
+//
+// One entry per MESSAGE_LIST line with id, data type, flag, access and unit. The names live in a
+// single string table that entries point into. Everything is constant initialized, nothing runs
+// when the dll is loaded. Lookups by id and by name go through the perfect hash of
+// tm_message_list.h.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_MESSAGE_CATALOG_H
+#define TM_MESSAGE_CATALOG_H
+
+#include "../shared/input/tm_external_message.h"
+#include "tm_message_list.h"
+
+#include <string.h>
+
+
+struct tm_message_catalog_entry
+{
+  tm_uint64        ID;
+  tm_uint32        Flag;          // a single tm_msg_flag, all of them fit into 32 bits
+  tm_msg_unit      Unit;
+  tm_uint16        NameOffset;    // into tm_message_catalog_names
+  tm_uint8         NameLength;
+  tm_msg_data_type DataType;
+  tm_msg_access    Access;
+};
+
+static_assert( sizeof( tm_message_catalog_entry ) == 24, "unexpected size of tm_message_catalog_entry" );
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// string table, all names zero terminated one after another
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#define TM_CATALOG_NAME_SIZE( a1, a2, a3, a4, a5, a6, a7 )  + sizeof( a2 )
+
+constexpr tm_uint32 tm_message_catalog_names_size = 0 MESSAGE_LIST( TM_CATALOG_NAME_SIZE );
+
+static_assert( tm_message_catalog_names_size < 0x10000, "name offsets do not fit into 16 bits" );
+
+struct tm_message_catalog_string_table
+{
+  char      Chars[tm_message_catalog_names_size] = {};
+  tm_uint16 Offsets[tm_message_count]            = {};
+  tm_uint8  Lengths[tm_message_count]            = {};
+};
+
+constexpr tm_message_catalog_string_table tm_message_catalog_build_names()
+{
+  tm_message_catalog_string_table table{};
+
+  tm_uint32 pos = 0;
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    const char *name   = tm_message_id_names[i];
+    tm_uint32   length = 0;
+
+    table.Offsets[i] = static_cast<tm_uint16>( pos );
+    for( ; name[length] != 0; ++length ) { table.Chars[pos++] = name[length]; }
+    table.Chars[pos++] = 0;
+    table.Lengths[i]   = static_cast<tm_uint8>( length );
+  }
+
+  return table;
+}
+
+inline constexpr tm_message_catalog_string_table tm_message_catalog_names = tm_message_catalog_build_names();
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the catalog
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#define TM_CATALOG_ENTRY( a1, a2, a3, a4, a5, a6, a7 )                                                      \
+  tm_message_catalog_entry{ tm_string_hash( a2 ).GetHash(), static_cast<tm_uint32>( a4 ), a6,                \
+                            tm_message_catalog_names.Offsets[static_cast<tm_uint32>( tm_message_index::a1 )], \
+                            tm_message_catalog_names.Lengths[static_cast<tm_uint32>( tm_message_index::a1 )], \
+                            a3, a5 },
+
+inline constexpr tm_message_catalog_entry tm_message_catalog[] =
+{
+  MESSAGE_LIST( TM_CATALOG_ENTRY )
+};
+
+static_assert( sizeof( tm_message_catalog ) / sizeof( tm_message_catalog[0] ) == tm_message_count, "catalog and message list do not match" );
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// lookups
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// same as tm_string_hasher, which includes the terminating zero
+constexpr tm_uint64 tm_message_catalog_hash( const char *name, const tm_uint32 length )
+{
+  tm_uint64 hash = 14695981039346656037ull;
+  for( tm_uint32 i = 0; i < length; ++i ) { hash = ( hash ^ name[i] ) * 1099511628211ull; }
+  return ( hash ^ 0 ) * 1099511628211ull;
+}
+
+inline const tm_message_catalog_entry *tm_message_catalog_find( const tm_message_index index )
+{
+  return index < tm_message_index::Count ? &tm_message_catalog[static_cast<tm_uint32>( index )] : nullptr;
+}
+
+inline const tm_message_catalog_entry *tm_message_catalog_find( const tm_uint64 message_id )
+{
+  return tm_message_catalog_find( tm_message_lookup( message_id ) );
+}
+
+inline const char *tm_message_catalog_get_name( const tm_message_catalog_entry &entry )
+{
+  return &tm_message_catalog_names.Chars[entry.NameOffset];
+}
+
+// returns "unknown" for ids that are not in the catalog
+inline const char *tm_message_catalog_get_name( const tm_uint64 message_id )
+{
+  const auto *entry = tm_message_catalog_find( message_id );
+  return entry != nullptr ? tm_message_catalog_get_name( *entry ) : "unknown";
+}
+
+// returns tm_message_index::Count for unknown names
+inline tm_message_index tm_message_catalog_find_index( const char *name, const tm_uint32 length )
+{
+  const tm_message_index index = tm_message_lookup( tm_message_catalog_hash( name, length ) );
+  if( index == tm_message_index::Count ) { return index; }
+
+  const auto &entry = tm_message_catalog[static_cast<tm_uint32>( index )];
+  return entry.NameLength == length && memcmp( tm_message_catalog_get_name( entry ), name, length ) == 0 ? index : tm_message_index::Count;
+}
+
+inline tm_message_index tm_message_catalog_find_index( const char *name )
+{
+  return tm_message_catalog_find_index( name, static_cast<tm_uint32>( strlen( name ) ) );
+}
+
+// a message with the header of the catalog entry, ready for SetValue and AddToByteStream
+inline tm_external_message tm_message_catalog_create_message( const tm_message_catalog_entry &entry )
+{
+  return tm_external_message( tm_string_hash( entry.ID ), entry.DataType, static_cast<tm_msg_flag>( entry.Flag ), entry.Access, entry.Unit );
+}
+
+static_assert( tm_message_catalog_hash( "Aircraft.Pitch", 14 ) == tm_string_hash( "Aircraft.Pitch" ).GetHash(), "runtime and compile-time string hash differ" );
+
+#endif  // TM_MESSAGE_CATALOG_H
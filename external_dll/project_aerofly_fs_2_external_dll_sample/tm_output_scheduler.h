@@ -0,0 +1,322 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_output_scheduler.h - frames at a fixed rate from the irregular frames of the simulation
+//
+// Update runs at the frame rate of the simulation, 30 to 144 fps with jitter. Actuator controllers
+// want a steady stream at several hundred Hz instead. With output_rate set, the sender thread
+// wakes at that rate and sends a frame sampled from the last two simulation frames:
+//
+//  - the simulation time of a tick is the wall clock mapped onto the SimTime of the frames,
+//    minus a delay. the mapping is the smallest difference between the time a frame was pushed
+//    and its SimTime, so late frames do not move it. the default delay is one simulation frame
+//    plus twice the mean lateness of the frames against that mapping
+//  - up to the latest frame, values are interpolated linearly between the two frames
+//  - past it, because the next frame is late, values are dead-reckoned from the latest frame:
+//    with the value of their rate message when it is sent along (Aircraft.Velocity for
+//    Aircraft.Position, see tm_channel_plan.h), otherwise with the change between the two frames.
+//    the extrapolation stops after a limit and the values hold
+//
+// Angles are interpolated the short way around, discrete values (Int messages) switch at the
+// frame they change in. While the simulation is paused, its frames keep their SimTime and the
+// latest frame is sent unchanged.
+//
+// The scheduler only runs on the sender thread, its statistics are read after the thread stopped.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_OUTPUT_SCHEDULER_H
+#define TM_OUTPUT_SCHEDULER_H
+
+#include "../shared/telemetry/tm_telemetry_frame.h"
+#include "tm_platform.h"
+
+#include <chrono>
+#include <thread>
+#include <math.h>
+
+
+struct tm_output_channel
+{
+  double   Period     = 0;        // the value is an angle that wraps around after Period, 0 if it does not
+  double   RateScale  = 0;        // rate = ( Values[RateValue] - RateOffset ) * RateScale
+  double   RateOffset = 0;
+  tm_uint8 RateValue  = 0xff;     // the value that holds the rate, 0xff takes the change between the frames
+  bool     Hold       = false;    // discrete, not interpolated
+};
+
+struct tm_output_stats
+{
+  tm_uint64 Frames           = 0;
+  tm_uint64 MissedTicks      = 0;   // ticks skipped because the thread woke up more than a period late
+  tm_uint64 Extrapolated     = 0;   // frames past the latest simulation frame
+  tm_uint64 FirstNs          = 0;
+  tm_uint64 LastNs           = 0;
+  double    JitterSum        = 0;   // seconds between the tick and the frame being sampled
+  double    JitterMax        = 0;
+  double    ExtrapolationSum = 0;   // seconds past the latest simulation frame
+  double    ExtrapolationMax = 0;
+
+  double GetRate() const { return Frames > 1 && LastNs > FirstNs ? ( Frames - 1 ) * 1e9 / static_cast<double>( LastNs - FirstNs ) : 0; }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// sleeps until a steady_clock time in nanoseconds. the last stretch is spun, the sleep of the
+// system alone is late by up to a millisecond and more.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+inline tm_uint64 tm_output_get_time_ns()
+{
+  return static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+inline void tm_output_sleep_until( const tm_uint64 deadline_ns )
+{
+  constexpr tm_uint64 spin_ns = 200000;
+
+  tm_uint64 now = tm_output_get_time_ns();
+  if( deadline_ns > now + spin_ns )
+  {
+    std::this_thread::sleep_for( std::chrono::nanoseconds( deadline_ns - now - spin_ns ) );
+  }
+
+  while( tm_output_get_time_ns() < deadline_ns ) { std::this_thread::yield(); }
+}
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_frame_interpolator - samples the values between and after the last two frames
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_frame_interpolator
+{
+private:
+  tm_telemetry_frame Frames[2];
+  tm_uint32          Latest    = 0;
+  tm_uint32          NumFrames = 0;
+  tm_output_channel  Channels[tm_telemetry_max_channels];
+  double             MaxExtrapolation = 0.1;
+
+  // b - a, the short way around for angles
+  static double Difference( const double a, const double b, const double period )
+  {
+    const double d = b - a;
+    return period > 0 ? d - period * floor( d / period + 0.5 ) : d;
+  }
+
+  // into the range of 'reference', [0, period) or [-period / 2, period / 2)
+  static double Wrap( const double value, const double reference, const double period )
+  {
+    if( period <= 0 ) { return value; }
+    const double low = reference >= 0 ? 0 : -0.5 * period;
+    return value - period * floor( ( value - low ) / period );
+  }
+
+public:
+  tm_frame_interpolator() = default;
+
+  void Configure( const tm_output_channel *channels, const tm_uint32 num_channels, const double max_extrapolation )
+  {
+    for( tm_uint32 i = 0; i < tm_telemetry_max_channels; ++i ) { Channels[i] = i < num_channels ? channels[i] : tm_output_channel(); }
+    MaxExtrapolation = max_extrapolation;
+    Reset();
+  }
+
+  void Reset() { NumFrames = 0; }
+
+  tm_uint32                 GetNumFrames() const { return NumFrames; }
+  const tm_telemetry_frame &GetLatest()    const { return Frames[Latest]; }
+
+  //
+  // appends a frame with a later SimTime than the latest one, a frame with the same SimTime
+  // replaces the latest one
+  //
+  void Add( const tm_telemetry_frame &frame )
+  {
+    if( NumFrames > 0 && frame.SimTime <= Frames[Latest].SimTime )
+    {
+      Frames[Latest] = frame;
+      return;
+    }
+
+    Latest         = NumFrames > 0 ? Latest ^ 1 : 0;
+    Frames[Latest] = frame;
+    NumFrames      = NumFrames < 2 ? NumFrames + 1 : 2;
+  }
+
+  //
+  // the values at 'sim_time', returns the seconds it is past the latest frame, 0 if it was
+  // interpolated. the SimTime of 'frame' is the time the values are for, which is earlier when
+  // there is only one frame or the extrapolation limit is reached. needs at least one frame.
+  //
+  double Sample( const double sim_time, tm_telemetry_frame &frame ) const
+  {
+    const tm_telemetry_frame &b = Frames[Latest];
+    frame.Flags        = b.Flags;
+    frame.ChannelCount = b.ChannelCount;
+    frame.SimTime      = sim_time;
+    memcpy( frame.ChannelMask, b.ChannelMask, sizeof( frame.ChannelMask ) );
+
+    const tm_uint32 count = b.ChannelCount;
+    if( NumFrames < 2 )
+    {
+      frame.SimTime = b.SimTime;
+      memcpy( frame.Values, b.Values, count * sizeof( b.Values[0] ) );
+      return 0;
+    }
+
+    const tm_telemetry_frame &a    = Frames[Latest ^ 1];
+    const double              span = b.SimTime - a.SimTime;
+
+    if( sim_time <= b.SimTime )
+    {
+      // before the older frame, e.g. after the delay grew, it is sent as is
+      double u = ( sim_time - a.SimTime ) / span;
+      if( u < 0 ) { u = 0; frame.SimTime = a.SimTime; }
+
+      for( tm_uint32 i = 0; i < count; ++i )
+      {
+        const tm_output_channel &channel = Channels[i];
+        frame.Values[i] = channel.Hold ? a.Values[i] : Wrap( a.Values[i] + u * Difference( a.Values[i], b.Values[i], channel.Period ), b.Values[i], channel.Period );
+      }
+      return 0;
+    }
+
+    const double extrapolation = sim_time - b.SimTime;
+    const double dt            = extrapolation < MaxExtrapolation ? extrapolation : MaxExtrapolation;
+    frame.SimTime = b.SimTime + dt;
+
+    for( tm_uint32 i = 0; i < count; ++i )
+    {
+      const tm_output_channel &channel = Channels[i];
+      if( channel.Hold ) { frame.Values[i] = b.Values[i]; continue; }
+
+      const double rate = channel.RateValue < count ? ( b.Values[channel.RateValue] - channel.RateOffset ) * channel.RateScale
+                                                    : Difference( a.Values[i], b.Values[i], channel.Period ) / span;
+      frame.Values[i] = Wrap( b.Values[i] + rate * dt, b.Values[i], channel.Period );
+    }
+    return extrapolation;
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_output_scheduler - maps the wall clock onto the simulation frames
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_output_scheduler
+{
+private:
+  tm_frame_interpolator Interpolator;
+  tm_output_stats       Stats;
+  double                Delay         = -1;     // seconds, negative: one simulation frame and the lateness
+  double                FrameInterval = 0;      // mean SimTime between frames
+  double                Lateness      = 0;      // mean time frames arrive after ClockOffset says they would
+  double                ClockOffset   = 0;      // wall clock - SimTime, seconds
+  bool                  Paused        = false;
+
+public:
+  //
+  // 'delay' in seconds, negative for the mean interval of the simulation frames
+  //
+  void Configure( const tm_output_channel *channels, const tm_uint32 num_channels, const double delay, const double max_extrapolation )
+  {
+    Interpolator.Configure( channels, num_channels, max_extrapolation );
+    Delay = delay;
+    Reset();
+  }
+
+  void Reset()
+  {
+    Interpolator.Reset();
+    Stats         = tm_output_stats();
+    FrameInterval = 0;
+    Lateness      = 0;
+    ClockOffset   = 0;
+    Paused        = false;
+  }
+
+  const tm_output_stats &GetStats() const { return Stats; }
+  double                 GetDelay() const { return Delay >= 0 ? Delay : FrameInterval + 2.0 * Lateness; }
+
+  //
+  // a frame of the simulation and the time it was pushed at
+  //
+  void Push( const tm_telemetry_frame &frame, const tm_uint64 time_ns )
+  {
+    const double offset = time_ns * 1e-9 - frame.SimTime;
+
+    if( Interpolator.GetNumFrames() == 0 || frame.SimTime < Interpolator.GetLatest().SimTime )
+    {
+      // the first frame, or a new session
+      Interpolator.Reset();
+      FrameInterval = 0;
+      Lateness      = 0;
+      ClockOffset   = offset;
+      Paused        = false;
+    }
+    else if( frame.SimTime == Interpolator.GetLatest().SimTime )
+    {
+      // paused, the offset grows with every frame and is taken as is when the simulation goes on
+      Paused      = true;
+      ClockOffset = offset;
+    }
+    else
+    {
+      const double step = frame.SimTime - Interpolator.GetLatest().SimTime;
+      FrameInterval = FrameInterval > 0 ? FrameInterval + ( step - FrameInterval ) * 0.1 : step;
+
+      // frames are only ever late: follow an earlier arrival at once and a later one slowly
+      ClockOffset = Paused || offset < ClockOffset ? offset : ClockOffset + ( offset - ClockOffset ) * 0.02;
+      Lateness   += ( offset - ClockOffset - Lateness ) * 0.05;
+      Paused      = false;
+    }
+
+    Interpolator.Add( frame );
+  }
+
+  //
+  // samples the frame for the tick at 'scheduled_ns', now is 'now_ns'. returns false until the
+  // first frame arrived.
+  //
+  bool Sample( const tm_uint64 scheduled_ns, const tm_uint64 now_ns, tm_telemetry_frame &frame )
+  {
+    if( Interpolator.GetNumFrames() == 0 ) { return false; }
+
+    double extrapolation = 0;
+    if( Paused )
+    {
+      Interpolator.Sample( Interpolator.GetLatest().SimTime, frame );
+    }
+    else
+    {
+      extrapolation = Interpolator.Sample( now_ns * 1e-9 - ClockOffset - GetDelay(), frame );
+    }
+
+    const double jitter = now_ns > scheduled_ns ? ( now_ns - scheduled_ns ) * 1e-9 : 0;
+    if( Stats.Frames++ == 0 ) { Stats.FirstNs = now_ns; }
+    Stats.LastNs     = now_ns;
+    Stats.JitterSum += jitter;
+    Stats.JitterMax  = jitter > Stats.JitterMax ? jitter : Stats.JitterMax;
+    if( extrapolation > 0 )
+    {
+      ++Stats.Extrapolated;
+      Stats.ExtrapolationSum += extrapolation;
+      Stats.ExtrapolationMax  = extrapolation > Stats.ExtrapolationMax ? extrapolation : Stats.ExtrapolationMax;
+    }
+    return true;
+  }
+
+  void AddMissedTicks( const tm_uint64 count ) { Stats.MissedTicks += count; }
+};
+
+#endif  // TM_OUTPUT_SCHEDULER_H
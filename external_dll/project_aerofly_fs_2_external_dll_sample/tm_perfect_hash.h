@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_perfect_hash.h - compile-time perfect hash for 64 bit message ids
+//
+// Hash and displace: every key falls into a bucket, each bucket stores a displacement that moves
+// all of its keys into free slots of the table. The displacements are searched by the compiler,
+// a lookup is one bucket read, one slot read and one compare.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_PERFECT_HASH_H
+#define TM_PERFECT_HASH_H
+
+#include "../shared/input/tm_external_message.h"
+
+
+constexpr tm_uint16 tm_perfect_hash_not_found = 0xffff;
+
+template<tm_uint32 TableSize, tm_uint32 NumBuckets> class tm_perfect_hash_table
+{
+  static_assert( ( TableSize & ( TableSize - 1 ) ) == 0, "table size must be a power of two" );
+  static_assert( ( NumBuckets & ( NumBuckets - 1 ) ) == 0, "number of buckets must be a power of two" );
+
+public:
+  tm_uint64 Keys[TableSize]            = {};
+  tm_uint16 Values[TableSize]          = {};
+  tm_uint16 Displacements[NumBuckets]  = {};
+  bool      Valid                      = false;
+
+  static constexpr tm_uint32 Log2( const tm_uint32 n ) { return n <= 1 ? 0 : 1 + Log2( n / 2 ); }
+
+  // message ids are fnv hashes already, a single multiply-shift spreads them well enough
+  static constexpr tm_uint32 GetBucket( const tm_uint64 key )
+  {
+    return static_cast<tm_uint32>( ( key * 0x9e3779b97f4a7c15ull ) >> ( 64 - Log2( NumBuckets ) ) );
+  }
+
+  static constexpr tm_uint32 GetSlot( const tm_uint64 key, const tm_uint32 displacement )
+  {
+    return static_cast<tm_uint32>( ( ( key ^ ( displacement * 0xc2b2ae3d27d4eb4full ) ) * 0xff51afd7ed558ccdull ) >> ( 64 - Log2( TableSize ) ) );
+  }
+
+  // returns the value stored for the key or tm_perfect_hash_not_found
+  constexpr tm_uint16 Find( const tm_uint64 key ) const
+  {
+    const tm_uint32 slot = GetSlot( key, Displacements[GetBucket( key )] );
+    return Keys[slot] == key ? Values[slot] : tm_perfect_hash_not_found;
+  }
+};
+
+
+//
+// builds the table for keys[i] -> i. if a key occurs more than once the first index is stored.
+// Valid is false if no displacement could be found for a bucket, make the table larger then.
+//
+template<tm_uint32 TableSize, tm_uint32 NumBuckets, tm_uint32 N>
+constexpr tm_perfect_hash_table<TableSize, NumBuckets> tm_perfect_hash_build( const tm_uint64( &keys )[N] )
+{
+  using table_type = tm_perfect_hash_table<TableSize, NumBuckets>;
+
+  static_assert( N < tm_perfect_hash_not_found, "too many keys" );
+  static_assert( N <= TableSize, "table is too small" );
+
+  table_type table{};
+  for( tm_uint32 i = 0; i < TableSize; ++i ) { table.Values[i] = tm_perfect_hash_not_found; }
+
+  // sort the unique keys by bucket
+  tm_uint32 bucket_begin[NumBuckets + 1] = {};
+  tm_uint32 bucket_keys[N]               = {};
+  bool      unique[N]                    = {};
+
+  for( tm_uint32 i = 0; i < N; ++i )
+  {
+    unique[i] = true;
+    for( tm_uint32 j = 0; j < i && unique[i]; ++j ) { unique[i] = keys[j] != keys[i]; }
+    if( unique[i] ) { ++bucket_begin[table_type::GetBucket( keys[i] ) + 1]; }
+  }
+
+  tm_uint32 max_bucket_size = 0;
+  for( tm_uint32 b = 0; b < NumBuckets; ++b )
+  {
+    max_bucket_size = bucket_begin[b + 1] > max_bucket_size ? bucket_begin[b + 1] : max_bucket_size;
+    bucket_begin[b + 1] += bucket_begin[b];
+  }
+
+  tm_uint32 bucket_fill[NumBuckets] = {};
+  for( tm_uint32 i = 0; i < N; ++i )
+  {
+    if( !unique[i] ) { continue; }
+    const tm_uint32 b = table_type::GetBucket( keys[i] );
+    bucket_keys[bucket_begin[b] + bucket_fill[b]++] = i;
+  }
+
+  // place the largest buckets first, they are the hardest to fit
+  bool used[TableSize] = {};
+  for( tm_uint32 size = max_bucket_size; size > 0; --size )
+  {
+    for( tm_uint32 b = 0; b < NumBuckets; ++b )
+    {
+      if( bucket_begin[b + 1] - bucket_begin[b] != size ) { continue; }
+
+      bool placed = false;
+      for( tm_uint32 d = 0; d < 0x10000 && !placed; ++d )
+      {
+        tm_uint32 k = bucket_begin[b];
+        for( ; k < bucket_begin[b + 1]; ++k )
+        {
+          const tm_uint32 slot = table_type::GetSlot( keys[bucket_keys[k]], d );
+          if( used[slot] ) { break; }
+          used[slot] = true;
+        }
+
+        placed = k == bucket_begin[b + 1];
+        for( tm_uint32 r = bucket_begin[b]; r < k; ++r )
+        {
+          const tm_uint32 slot = table_type::GetSlot( keys[bucket_keys[r]], d );
+          if( placed )
+          {
+            table.Keys[slot]   = keys[bucket_keys[r]];
+            table.Values[slot] = static_cast<tm_uint16>( bucket_keys[r] );
+          }
+          else
+          {
+            used[slot] = false;
+          }
+        }
+
+        if( placed ) { table.Displacements[b] = static_cast<tm_uint16>( d ); }
+      }
+
+      if( !placed ) { return table; }
+    }
+  }
+
+  table.Valid = true;
+  return table;
+}
+
+#endif  // TM_PERFECT_HASH_H
@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_platform.h - the few platform specific bits the telemetry dll needs
+//
+// On Windows the dll is loaded by Aerofly FS 2. All other platforms are only used to build the
+// dll as a shared object, e.g. to replay recorded sessions or to run the benchmarks.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_PLATFORM_H
+#define TM_PLATFORM_H
+
+#if defined(WIN32) || defined(WIN64)
+  #define TM_PLATFORM_WINDOWS 1
+#else
+  #define TM_PLATFORM_WINDOWS 0
+#endif
+
+#if TM_PLATFORM_WINDOWS
+  #include <WS2tcpip.h>
+  #include <windows.h>
+
+  #define TM_DLL_EXPORT __declspec( dllexport )
+#else
+  #include <dlfcn.h>
+
+  using HINSTANCE = void *;
+
+  #define TM_DLL_EXPORT __attribute__( ( visibility( "default" ) ) )
+#endif
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// diagnostics go to the debugger output on windows and to stderr everywhere else
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+inline void tm_platform_log( const char *format, ... )
+{
+  char text[512];
+  va_list args;
+  va_start( args, format );
+  vsnprintf( text, sizeof( text ), format, args );
+  va_end( args );
+
+#if TM_PLATFORM_WINDOWS
+  OutputDebugStringA( "Aerofly_FS_2_GamePlugin_Telemetry: " );
+  OutputDebugStringA( text );
+  OutputDebugStringA( "\n" );
+#else
+  fprintf( stderr, "Aerofly_FS_2_GamePlugin_Telemetry: %s\n", text );
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// full path of the dll, used to find files that are installed next to it
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+inline bool tm_platform_get_module_path( const HINSTANCE module, char *path, const unsigned int path_size )
+{
+#if TM_PLATFORM_WINDOWS
+  const DWORD length = GetModuleFileNameA( module, path, path_size );
+  return length > 0 && length < path_size;
+#else
+  (void)module;
+  Dl_info info = {};
+  if( dladdr( reinterpret_cast<void*>( &tm_platform_get_module_path ), &info ) == 0 || info.dli_fname == nullptr ) { return false; }
+  const int length = snprintf( path, path_size, "%s", info.dli_fname );
+  return length > 0 && static_cast<unsigned int>( length ) < path_size;
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// splits off the next whitespace separated token of 's' in place, nullptr at the end. used by
+// the config file and the command lines of external tools.
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+inline char *tm_platform_next_token( char *&s )
+{
+  while( isspace( static_cast<unsigned char>( *s ) ) ) { ++s; }
+  if( *s == 0 ) { return nullptr; }
+
+  char *token = s;
+  while( *s != 0 && !isspace( static_cast<unsigned char>( *s ) ) ) { ++s; }
+  if( *s != 0 ) { *s++ = 0; }
+  return token;
+}
+
+#endif  // TM_PLATFORM_H
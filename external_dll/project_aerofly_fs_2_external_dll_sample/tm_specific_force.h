@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_specific_force.h - specific force in the body frame, derived every frame
+//
+// Aircraft.Acceleration is only updated about once per second. Aircraft.Velocity changes every
+// frame, so the acceleration is its derivative over the time since the previous velocity:
+//
+//   global velocity:  f = R^T * ( dv/dt - g )
+//   body velocity:    f = dv/dt + w x v - g_body          (transport theorem)
+//
+// with R the rotation from the body frame to the global frame, applied as the quaternion of
+// Aircraft.Orientation, w the body angular velocity and g Aircraft.Gravity. Velocity, acceleration
+// and gravity are global unless their message has the Body flag. The result is in the body axes
+// of Aircraft.Orientation, in m/s^2; at rest it points up with 1 g.
+//
+// Aircraft.Orientation is read as a quaternion when it arrives with four values, in the member
+// order of tm_quaterniond (r, x, y, z). Without an orientation only a body velocity with a body
+// gravity can be used.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_SPECIFIC_FORCE_H
+#define TM_SPECIFIC_FORCE_H
+
+#include "../shared/input/tm_external_message.h"
+#include "tm_external_message_view.h"
+#include "tm_message_list.h"
+
+
+constexpr double tm_standard_gravity = 9.80665;
+
+class tm_specific_force_estimator
+{
+private:
+  tm_vector3d    Velocity;
+  tm_vector3d    PreviousVelocity;
+  tm_vector3d    Gravity;
+  tm_vector3d    AngularVelocity;
+  tm_vector3d    Acceleration;
+  tm_quaterniond Orientation;                  // body to global
+  tm_vector3d    SpecificForce;
+  double         VelocityTime     = 0;         // since PreviousVelocity was received
+
+  bool           VelocityBody     = false;
+  bool           AccelerationBody = false;
+  bool           GravityBody      = false;
+  bool           HasOrientation   = false;
+  bool           NewVelocity      = false;
+  bool           HasPrevious      = false;
+  bool           Valid            = false;
+
+  static tm_vector3d Rotate( const tm_quaterniond &q, const tm_vector3d &v )
+  {
+    const tm_quaterniond r = tm_QuaternionRot( q, tm_quaterniond( 0, v ) );
+    return { r.x, r.y, r.z };
+  }
+
+  tm_vector3d ToBody( const tm_vector3d &global ) const { return Rotate( tm_QuaternionConj( Orientation ), global ); }
+  tm_vector3d ToGlobal( const tm_vector3d &body ) const { return Rotate( Orientation, body ); }
+
+  bool CanRotate( const bool body ) const { return HasOrientation || ( body && GravityBody ); }
+
+  tm_vector3d ToSpecificForce( const tm_vector3d &acceleration, const bool body ) const
+  {
+    if( body ) { return acceleration - ( GravityBody ? Gravity : ToBody( Gravity ) ); }
+    return ToBody( acceleration - ( GravityBody ? ToGlobal( Gravity ) : Gravity ) );
+  }
+
+public:
+  void Reset() { *this = tm_specific_force_estimator(); }
+
+  //
+  // takes the messages the estimate depends on, the others are ignored
+  //
+  void Observe( const tm_message_index index, const tm_external_message_view message )
+  {
+    const auto data_type = message.GetDataType();
+
+    switch( index )
+    {
+      case tm_message_index::AircraftVelocity:
+        if( data_type != tm_msg_data_type::Vector3d ) { return; }
+        Velocity     = message.GetVector3d();
+        VelocityBody = message.GetFlags().IsSet( tm_msg_flag::Body );
+        NewVelocity  = true;
+        return;
+
+      case tm_message_index::AircraftGravity:
+        if( data_type != tm_msg_data_type::Vector3d ) { return; }
+        Gravity     = message.GetVector3d();
+        GravityBody = message.GetFlags().IsSet( tm_msg_flag::Body );
+        return;
+
+      case tm_message_index::AircraftAngularVelocity:
+        if( data_type == tm_msg_data_type::Vector3d ) { AngularVelocity = message.GetVector3d(); }
+        return;
+
+      case tm_message_index::AircraftAcceleration:
+        if( data_type != tm_msg_data_type::Vector3d ) { return; }
+        Acceleration     = message.GetVector3d();
+        AccelerationBody = message.GetFlags().IsSet( tm_msg_flag::Body );
+        return;
+
+      case tm_message_index::AircraftOrientation:
+        if( data_type == tm_msg_data_type::Vector4d )
+        {
+          const tm_vector4d q = message.GetVector4d();
+          Orientation    = tm_quaterniond( q.x, q.y, q.z, q.w );
+          HasOrientation = true;
+        }
+        return;
+
+      default:
+        return;
+    }
+  }
+
+  //
+  // call once per Update after all messages were observed. frames without a new velocity keep
+  // the previous result.
+  //
+  void Update( const double delta_time )
+  {
+    if( delta_time > 0 ) { VelocityTime += delta_time; }
+    if( !NewVelocity ) { return; }
+    NewVelocity = false;
+
+    if( HasPrevious && VelocityTime > 0 && CanRotate( VelocityBody ) )
+    {
+      tm_vector3d acceleration = ( Velocity - PreviousVelocity ) * ( 1.0 / VelocityTime );
+      if( VelocityBody ) { acceleration = acceleration + CrossProduct( AngularVelocity, Velocity ); }
+
+      SpecificForce = ToSpecificForce( acceleration, VelocityBody );
+      Valid         = true;
+    }
+
+    PreviousVelocity = Velocity;
+    VelocityTime     = 0;
+    HasPrevious      = true;
+  }
+
+  bool IsValid() const { return Valid; }
+
+  //
+  // the derived specific force. until the first estimate it falls back to Aircraft.Acceleration
+  // minus Aircraft.Gravity, as received.
+  //
+  tm_vector3d GetSpecificForce() const { return Valid ? SpecificForce : Acceleration - Gravity; }
+
+  // longitudinal, lateral and vertical load factor in g
+  tm_vector3d GetLoadFactor() const { return GetSpecificForce() * ( 1.0 / tm_standard_gravity ); }
+
+  // Aircraft.Acceleration through the same transformation, to compare the estimate with
+  tm_vector3d GetReferenceSpecificForce() const
+  {
+    return CanRotate( AccelerationBody ) ? ToSpecificForce( Acceleration, AccelerationBody ) : Acceleration - Gravity;
+  }
+
+  const tm_vector3d &GetAcceleration()    const { return Acceleration; }
+  const tm_vector3d &GetAngularVelocity() const { return AngularVelocity; }
+};
+
+#endif  // TM_SPECIFIC_FORCE_H
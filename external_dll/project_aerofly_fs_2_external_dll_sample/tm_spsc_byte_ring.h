@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_spsc_byte_ring.h - bounded lock-free single-producer/single-consumer ring of byte records
+//
+// tm_spsc_queue moves fixed size items, this ring moves records of any size, e.g. whole received
+// byte streams. Every record is a 4 byte length followed by its bytes, records wrap around the
+// end of the buffer. A record that does not fit is dropped by the producer, neither side blocks.
+// The consumer can sleep in WaitForData() until the producer pushes, the producer only makes the
+// wake-up call when the consumer is asleep.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_SPSC_BYTE_RING_H
+#define TM_SPSC_BYTE_RING_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <atomic>
+#include <memory>
+#include <string.h>
+
+
+class tm_spsc_byte_ring
+{
+private:
+  std::unique_ptr<tm_uint8[]> Buffer;
+  tm_uint64                   Mask = 0;
+
+  alignas( 64 ) std::atomic<tm_uint64> Head{ 0 };      // next byte to read, consumer only
+  alignas( 64 ) std::atomic<tm_uint64> Tail{ 0 };      // next byte to write, producer only
+  alignas( 64 ) std::atomic<tm_uint32> Signal{ 0 };    // bumped on every push, the consumer waits on it
+  std::atomic<bool>                    Sleeping{ false };  // the consumer is in WaitForData
+  std::atomic<tm_uint64>               Dropped{ 0 };
+
+  void Write( const tm_uint64 pos, const void *data, const tm_uint64 size )
+  {
+    const tm_uint64 offset = pos & Mask;
+    const tm_uint64 first  = size < Mask + 1 - offset ? size : Mask + 1 - offset;
+    memcpy( &Buffer[offset], data, first );
+    memcpy( &Buffer[0], static_cast<const tm_uint8*>( data ) + first, size - first );
+  }
+
+  void Read( const tm_uint64 pos, void *data, const tm_uint64 size ) const
+  {
+    const tm_uint64 offset = pos & Mask;
+    const tm_uint64 first  = size < Mask + 1 - offset ? size : Mask + 1 - offset;
+    memcpy( data, &Buffer[offset], first );
+    memcpy( static_cast<tm_uint8*>( data ) + first, &Buffer[0], size - first );
+  }
+
+public:
+  tm_spsc_byte_ring() = default;
+  tm_spsc_byte_ring( const tm_spsc_byte_ring & ) = delete;
+  tm_spsc_byte_ring &operator=( const tm_spsc_byte_ring & ) = delete;
+
+  //
+  // allocates the buffer, the capacity is rounded up to the next power of two. not thread safe.
+  //
+  void Reset( const tm_uint64 capacity )
+  {
+    tm_uint64 size = 64;
+    while( size < capacity ) { size *= 2; }
+
+    // touch every page now, not on the producer thread when the first records are written
+    Buffer.reset( new tm_uint8[size] );
+    memset( Buffer.get(), 0, size );
+    Mask = size - 1;
+
+    Head.store( 0, std::memory_order_relaxed );
+    Tail.store( 0, std::memory_order_relaxed );
+    Dropped.store( 0, std::memory_order_relaxed );
+  }
+
+  tm_uint64 GetCapacity() const { return Mask + 1; }
+  tm_uint64 GetDropped()  const { return Dropped.load( std::memory_order_relaxed ); }
+
+  //
+  // producer side, appends one record made of two parts, e.g. a header and a payload.
+  // returns false and counts the record as dropped if there is not enough free space.
+  //
+  bool Push( const void *a, const tm_uint32 a_size, const void *b, const tm_uint32 b_size )
+  {
+    const tm_uint32 size = a_size + b_size;
+    const tm_uint64 tail = Tail.load( std::memory_order_relaxed );
+    const tm_uint64 head = Head.load( std::memory_order_acquire );
+
+    if( sizeof( size ) + size > Mask + 1 - ( tail - head ) )
+    {
+      Dropped.fetch_add( 1, std::memory_order_relaxed );
+      return false;
+    }
+
+    Write( tail, &size, sizeof( size ) );
+    Write( tail + sizeof( size ), a, a_size );
+    Write( tail + sizeof( size ) + a_size, b, b_size );
+    Tail.store( tail + sizeof( size ) + size, std::memory_order_release );
+
+    // pairs with WaitForData, one of both sees the store of the other
+    Signal.fetch_add( 1, std::memory_order_seq_cst );
+    if( Sleeping.load( std::memory_order_seq_cst ) ) { Signal.notify_one(); }
+    return true;
+  }
+
+  //
+  // consumer side. Peek() returns the size of the next record, Pop() copies it out.
+  //
+  bool Peek( tm_uint32 &size ) const
+  {
+    const tm_uint64 head = Head.load( std::memory_order_relaxed );
+    if( head == Tail.load( std::memory_order_acquire ) ) { return false; }
+
+    Read( head, &size, sizeof( size ) );
+    return true;
+  }
+
+  // copies the record returned by Peek() into 'data'
+  void Pop( void *data, const tm_uint32 size )
+  {
+    const tm_uint64 head = Head.load( std::memory_order_relaxed );
+    Read( head + sizeof( size ), data, size );
+    Head.store( head + sizeof( size ) + size, std::memory_order_release );
+  }
+
+  tm_uint32 GetSignal() const { return Signal.load( std::memory_order_acquire ); }
+
+  // sleeps until a push happened after 'signal' was read with GetSignal()
+  void WaitForData( const tm_uint32 signal )
+  {
+    Sleeping.store( true, std::memory_order_seq_cst );
+    if( Signal.load( std::memory_order_seq_cst ) == signal ) { Signal.wait( signal, std::memory_order_acquire ); }
+    Sleeping.store( false, std::memory_order_relaxed );
+  }
+
+  // wakes a waiting consumer without pushing, e.g. to shut it down
+  void Wake()
+  {
+    Signal.fetch_add( 1, std::memory_order_release );
+    Signal.notify_one();
+  }
+};
+
+#endif  // TM_SPSC_BYTE_RING_H
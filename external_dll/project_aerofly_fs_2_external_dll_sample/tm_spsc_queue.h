@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_spsc_queue.h - bounded lock-free single-producer/single-consumer ring
+//
+// Every slot carries a sequence number that tells who owns it, which lets the producer drop the
+// oldest entry itself when the ring is full without ever touching a slot the consumer is reading.
+// Neither side blocks. The consumer can sleep in WaitForData() until the producer pushes, the
+// producer only makes the wake-up call when the consumer is asleep.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_SPSC_QUEUE_H
+#define TM_SPSC_QUEUE_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <atomic>
+#include <memory>
+
+
+enum class tm_queue_full_policy : tm_uint8
+{
+  DropOldest,
+  DropNewest
+};
+
+
+template<typename T> class tm_spsc_queue
+{
+private:
+  struct tm_slot
+  {
+    std::atomic<tm_uint64> Sequence{ 0 };
+    T                      Data;
+  };
+
+  std::unique_ptr<tm_slot[]> Slots;
+  tm_uint64                  Mask = 0;
+
+  alignas( 64 ) std::atomic<tm_uint64> Head{ 0 };      // next position to pop, consumer (and producer when dropping)
+  alignas( 64 ) std::atomic<tm_uint64> Tail{ 0 };      // next position to push, producer only
+  alignas( 64 ) std::atomic<tm_uint32> Signal{ 0 };    // bumped on every push, the consumer waits on it
+  std::atomic<bool>                    Sleeping{ false };  // the consumer is in WaitForData
+  std::atomic<tm_uint64>               Dropped{ 0 };
+
+  bool PopInternal( T *data )
+  {
+    tm_uint64 pos = Head.load( std::memory_order_relaxed );
+    for( ;; )
+    {
+      tm_slot &slot = Slots[pos & Mask];
+      const auto seq  = slot.Sequence.load( std::memory_order_acquire );
+      const auto diff = static_cast<int64_t>( seq ) - static_cast<int64_t>( pos + 1 );
+
+      if( diff == 0 )
+      {
+        if( Head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+        {
+          if( data != nullptr ) { *data = slot.Data; }
+          slot.Sequence.store( pos + Mask + 1, std::memory_order_release );
+          return true;
+        }
+      }
+      else if( diff < 0 )
+      {
+        return false;
+      }
+      else
+      {
+        pos = Head.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+public:
+  tm_spsc_queue() = default;
+  tm_spsc_queue( const tm_spsc_queue & ) = delete;
+  tm_spsc_queue &operator=( const tm_spsc_queue & ) = delete;
+
+  //
+  // allocates the ring, the capacity is rounded up to the next power of two. not thread safe.
+  //
+  void Reset( const tm_uint32 capacity )
+  {
+    tm_uint64 size = 2;
+    while( size < capacity ) { size *= 2; }
+
+    Slots.reset( new tm_slot[size] );
+    Mask = size - 1;
+    for( tm_uint64 i = 0; i < size; ++i ) { Slots[i].Sequence.store( i, std::memory_order_relaxed ); }
+
+    Head.store( 0, std::memory_order_relaxed );
+    Tail.store( 0, std::memory_order_relaxed );
+    Dropped.store( 0, std::memory_order_relaxed );
+  }
+
+  tm_uint64 GetCapacity() const { return Mask + 1; }
+  tm_uint64 GetDropped()  const { return Dropped.load( std::memory_order_relaxed ); }
+
+  //
+  // producer side. returns false if the item was dropped, with DropOldest the oldest item is
+  // discarded instead unless the consumer is reading that very slot right now.
+  //
+  bool Push( const T &data, const tm_queue_full_policy policy )
+  {
+    for( int attempt = 0; attempt < 2; ++attempt )
+    {
+      const tm_uint64 pos = Tail.load( std::memory_order_relaxed );
+      tm_slot &slot = Slots[pos & Mask];
+
+      if( slot.Sequence.load( std::memory_order_acquire ) == pos )
+      {
+        slot.Data = data;
+        slot.Sequence.store( pos + 1, std::memory_order_release );
+        Tail.store( pos + 1, std::memory_order_relaxed );
+
+        // pairs with WaitForData, one of both sees the store of the other
+        Signal.fetch_add( 1, std::memory_order_seq_cst );
+        if( Sleeping.load( std::memory_order_seq_cst ) ) { Signal.notify_one(); }
+        return true;
+      }
+
+      if( policy == tm_queue_full_policy::DropNewest || attempt > 0 ) { break; }
+      if( PopInternal( nullptr ) ) { Dropped.fetch_add( 1, std::memory_order_relaxed ); }
+    }
+
+    Dropped.fetch_add( 1, std::memory_order_relaxed );
+    return false;
+  }
+
+  //
+  // consumer side
+  //
+  bool Pop( T &data ) { return PopInternal( &data ); }
+
+  tm_uint32 GetSignal() const { return Signal.load( std::memory_order_acquire ); }
+
+  // sleeps until a push happened after 'signal' was read with GetSignal()
+  void WaitForData( const tm_uint32 signal )
+  {
+    Sleeping.store( true, std::memory_order_seq_cst );
+    if( Signal.load( std::memory_order_seq_cst ) == signal ) { Signal.wait( signal, std::memory_order_acquire ); }
+    Sleeping.store( false, std::memory_order_relaxed );
+  }
+
+  // wakes a waiting consumer without pushing, e.g. to shut it down
+  void Wake()
+  {
+    Signal.fetch_add( 1, std::memory_order_release );
+    Signal.notify_one();
+  }
+};
+
+#endif  // TM_SPSC_QUEUE_H
@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_stage_stats.h - where the time of a frame goes, from Update to the socket
+//
+// Update and the sender thread time their stages with Lap() into one tm_latency_histogram each:
+//
+//   decode     Update entry until the received byte stream is ready to be walked, with recording
+//   extract    walking the messages and picking the channels out of them
+//   derive     specific force, washout and the local frame
+//   handoff    publishing the state, pushing the frame to the sender thread and forwarding commands
+//   update     all of Update
+//   queue      from the push until the sender thread took the frame, without an output rate
+//   send       encoding and sending on the sender thread, shared memory included
+//
+// When the stats are off Begin() returns 0 and Lap() returns right away, no clock is read. When
+// they are on, a thread of its own publishes p50, p99, p99.9 and the maximum of every stage over
+// the last interval as a text datagram, as lines appended to a file, or to the log.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_STAGE_STATS_H
+#define TM_STAGE_STATS_H
+
+#include "tm_latency_histogram.h"
+#include "tm_platform.h"
+#include "tm_udp_sender.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <stdio.h>
+#include <string.h>
+
+
+enum class tm_stage : tm_uint8
+{
+  Decode,
+  Extract,
+  Derive,
+  Handoff,
+  Update,
+  Queue,
+  Send,
+  Count
+};
+
+constexpr const char *tm_stage_names[] = { "decode", "extract", "derive", "handoff", "update", "queue", "send" };
+
+static_assert( sizeof( tm_stage_names ) / sizeof( tm_stage_names[0] ) == static_cast<tm_uint32>( tm_stage::Count ), "a stage has no name" );
+
+constexpr tm_uint32 tm_stage_count = static_cast<tm_uint32>( tm_stage::Count );
+
+
+class tm_stage_stats
+{
+private:
+  struct tm_stage_state
+  {
+    tm_latency_histogram Histogram;
+    tm_latency_snapshot  Previous;      // publisher thread only
+    tm_latency_snapshot  Interval;
+  };
+
+  std::unique_ptr<tm_stage_state[]> Stages;
+  bool                              Enabled    = false;
+  double                            Interval   = 0;      // seconds between two publications
+  char                              Path[512]  = {};
+  tm_udp_sender                     Sender;
+  std::thread                       Thread;
+  std::atomic<bool>                 Running{ false };
+  tm_uint64                         StartNs    = 0;
+
+  static tm_uint64 GetTimeNs()
+  {
+    return static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+  }
+
+  // one line per stage with its values of the interval, in microseconds
+  tm_uint32 Format( char *text, const tm_uint32 text_size )
+  {
+    int length = snprintf( text, text_size, "stage_stats time=%.1f\n", ( GetTimeNs() - StartNs ) * 1e-9 );
+
+    for( tm_uint32 i = 0; i < tm_stage_count && length >= 0 && static_cast<tm_uint32>( length ) < text_size; ++i )
+    {
+      tm_stage_state      &stage    = Stages[i];
+      tm_latency_snapshot &interval = stage.Interval;
+      stage.Histogram.Snapshot( interval );
+      const tm_latency_snapshot current = interval;
+      interval.Subtract( stage.Previous );
+      stage.Previous = current;
+
+      // the maximum of the interval is the highest bucket with a count
+      if( interval.Count > 0 )
+      {
+        length += snprintf( text + length, text_size - length, "%s count=%llu p50=%.1f p99=%.1f p99.9=%.1f max=%.1f\n", tm_stage_names[i],
+                            static_cast<unsigned long long>( interval.Count ), interval.GetPercentile( 50 ) * 1e-3, interval.GetPercentile( 99 ) * 1e-3,
+                            interval.GetPercentile( 99.9 ) * 1e-3, interval.GetPercentile( 100 ) * 1e-3 );
+      }
+    }
+
+    return length < 0 ? 0 : ( static_cast<tm_uint32>( length ) < text_size ? static_cast<tm_uint32>( length ) : text_size - 1 );
+  }
+
+  void Publish()
+  {
+    char            text[1024];
+    const tm_uint32 length = Format( text, sizeof( text ) );
+
+    if( Sender.IsOpen() ) { Sender.Send( text, length ); }
+
+    if( Path[0] != 0 )
+    {
+      FILE *file = fopen( Path, "a" );
+      if( file != nullptr )
+      {
+        fwrite( text, 1, length, file );
+        fclose( file );
+      }
+    }
+
+    if( !Sender.IsOpen() && Path[0] == 0 )
+    {
+      for( char *line = text, *end = nullptr; *line != 0; line = end + 1 )
+      {
+        end = strchr( line, '\n' );
+        if( end == nullptr ) { break; }
+        *end = 0;
+        tm_platform_log( "%s", line );
+      }
+    }
+  }
+
+  void Run()
+  {
+    tm_uint64 next = GetTimeNs() + static_cast<tm_uint64>( Interval * 1e9 );
+
+    while( Running.load( std::memory_order_acquire ) )
+    {
+      // short naps so Stop() does not wait for a whole interval
+      std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+      if( GetTimeNs() < next ) { continue; }
+
+      Publish();
+      next += static_cast<tm_uint64>( Interval * 1e9 );
+    }
+  }
+
+public:
+  tm_stage_stats() = default;
+  tm_stage_stats( const tm_stage_stats & ) = delete;
+  tm_stage_stats &operator=( const tm_stage_stats & ) = delete;
+  ~tm_stage_stats() { Stop(); }
+
+  //
+  // 'interval' seconds between two publications, 0 turns the probes off. 'host' and 'service'
+  // send the stats as datagrams, 'path' appends them to a file, without either they are logged.
+  //
+  bool Start( const double interval, const char *host, const char *service, const char *path )
+  {
+    Stop();
+
+    Enabled = interval > 0;
+    if( !Enabled ) { return false; }
+
+    if( Stages == nullptr ) { Stages.reset( new tm_stage_state[tm_stage_count] ); }
+    for( tm_uint32 i = 0; i < tm_stage_count; ++i )
+    {
+      Stages[i].Histogram.Reset();
+      Stages[i].Previous = tm_latency_snapshot();
+    }
+
+    Interval = interval;
+    snprintf( Path, sizeof( Path ), "%s", path != nullptr ? path : "" );
+    if( host != nullptr && host[0] != 0 && !Sender.Open( host, service ) ) { tm_platform_log( "cannot send stage stats to %s:%s", host, service ); }
+
+    StartNs = GetTimeNs();
+    Running.store( true, std::memory_order_release );
+    Thread  = std::thread( &tm_stage_stats::Run, this );
+    return true;
+  }
+
+  // the probes stay readable for the summary until the next Start()
+  void Stop()
+  {
+    if( Thread.joinable() )
+    {
+      Running.store( false, std::memory_order_release );
+      Thread.join();
+    }
+
+    Sender.Close();
+  }
+
+  bool IsEnabled() const { return Enabled; }
+
+  //
+  // probes, 0 when the stats are off. Lap() records the time since 'start' for the stage and
+  // returns the current time, the start of the next stage.
+  //
+  tm_uint64 Begin() const { return Enabled ? GetTimeNs() : 0; }
+
+  tm_uint64 Lap( const tm_stage stage, const tm_uint64 start )
+  {
+    if( start == 0 ) { return 0; }
+
+    const tm_uint64 now = GetTimeNs();
+    Stages[static_cast<tm_uint32>( stage )].Histogram.Record( now - start );
+    return now;
+  }
+
+  // a duration that was measured elsewhere
+  void Record( const tm_stage stage, const tm_uint64 duration_ns )
+  {
+    if( Enabled ) { Stages[static_cast<tm_uint32>( stage )].Histogram.Record( duration_ns ); }
+  }
+
+  //
+  // the whole session, for the summary at shutdown
+  //
+  void GetSnapshot( const tm_stage stage, tm_latency_snapshot &snapshot ) const
+  {
+    if( Enabled ) { Stages[static_cast<tm_uint32>( stage )].Histogram.Snapshot( snapshot ); }
+    else          { snapshot = tm_latency_snapshot(); }
+  }
+};
+
+#endif  // TM_STAGE_STATS_H
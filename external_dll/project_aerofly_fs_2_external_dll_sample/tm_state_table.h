@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_state_table.h - the last received value of every message, in one dense table
+//
+// One slot per MESSAGE_LIST entry, sized by tm_msg_data_type_size of its catalog type and laid out
+// one after another in catalog order. Update() copies the payload of a received message into its
+// slot in place, the slot keeps it until the message arrives again. Next to the values the table
+// keeps for every slot the data type and flags it was received with and the simulation time of
+// the last update, and a bitset of the slots updated in the current frame.
+//
+// Encoders, filters and debug output read the state from here instead of walking the received
+// messages again. A message that is not sent in a frame keeps its last value, one that was never
+// received reads as 0.
+//
+// The catalog type of a few messages does not match what the simulation sends, their slots take
+// the type of tm_state_table_slot_types instead. A payload larger than its slot is cut off.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_STATE_TABLE_H
+#define TM_STATE_TABLE_H
+
+#include "tm_external_message_view.h"
+#include "tm_message_catalog.h"
+
+#include <bit>
+#include <string.h>
+
+
+// messages that arrive with another type than their catalog entry
+struct tm_state_table_slot_type
+{
+  tm_message_index Index;
+  tm_msg_data_type DataType;
+};
+
+inline constexpr tm_state_table_slot_type tm_state_table_slot_types[] =
+{
+  { tm_message_index::AircraftOrientation, tm_msg_data_type::Vector4d },      // a quaternion, see tm_specific_force.h
+};
+
+struct tm_state_table_layout
+{
+  tm_uint32 Offsets[tm_message_count + 1] = {};      // in doubles, the last one is the size of the table
+};
+
+constexpr tm_state_table_layout tm_state_table_build_layout()
+{
+  tm_state_table_layout layout{};
+
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    tm_msg_data_type data_type = tm_message_catalog[i].DataType;
+    for( const auto &slot_type : tm_state_table_slot_types )
+    {
+      if( static_cast<tm_uint32>( slot_type.Index ) == i ) { data_type = slot_type.DataType; }
+    }
+
+    layout.Offsets[i + 1] = layout.Offsets[i] + static_cast<tm_uint32>( tm_msg_data_type_size( data_type ) ) / sizeof( double );
+  }
+
+  return layout;
+}
+
+inline constexpr tm_state_table_layout tm_state_table_layout_of_catalog = tm_state_table_build_layout();
+
+constexpr tm_uint32 tm_state_table_size        = tm_state_table_layout_of_catalog.Offsets[tm_message_count];
+constexpr tm_uint32 tm_state_table_dirty_words = ( tm_message_count + 63 ) / 64;
+
+// the slots of a table that did not receive anything yet
+struct tm_state_table_slot_states
+{
+  double           UpdateTimes[tm_message_count];     // -1 until the first update
+  tm_msg_data_type DataTypes[tm_message_count];       // None until the first update
+};
+
+constexpr tm_state_table_slot_states tm_state_table_build_empty_slots()
+{
+  tm_state_table_slot_states slots{};
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    slots.UpdateTimes[i] = -1;
+    slots.DataTypes[i]   = tm_msg_data_type::None;
+  }
+  return slots;
+}
+
+inline constexpr tm_state_table_slot_states tm_state_table_empty_slots = tm_state_table_build_empty_slots();
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_state_table - written and read on the simulation thread
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_state_table
+{
+private:
+  double                     Values[tm_state_table_size]       = {};
+  tm_state_table_slot_states Slots                             = tm_state_table_empty_slots;
+  tm_msg_flag_set            Flags[tm_message_count]           = {};
+  tm_uint8                   DataSizes[tm_message_count]       = {};     // bytes of the last payload
+  tm_uint64                  Dirty[tm_state_table_dirty_words] = {};
+  double                     SimulationTime                    = 0;
+
+  static tm_uint32 GetSlot( const tm_message_index index ) { return static_cast<tm_uint32>( index ); }
+
+public:
+  // constexpr so a global table is constant initialized and runs no code when the dll is loaded
+  constexpr tm_state_table() = default;
+
+  // forgets every value
+  void Reset()
+  {
+    memset( Values, 0, sizeof( Values ) );
+    memset( DataSizes, 0, sizeof( DataSizes ) );
+    memset( Dirty, 0, sizeof( Dirty ) );
+    for( auto &flags : Flags ) { flags = tm_msg_flag_set(); }
+    Slots          = tm_state_table_empty_slots;
+    SimulationTime = 0;
+  }
+
+  //
+  // starts a frame at 'simulation_time', no slot is dirty afterwards
+  //
+  void BeginFrame( const double simulation_time )
+  {
+    memset( Dirty, 0, sizeof( Dirty ) );
+    SimulationTime = simulation_time;
+  }
+
+  //
+  // copies the payload of a received message into the slot of 'index', unknown messages are ignored
+  //
+  void Update( const tm_message_index index, const tm_external_message_view message )
+  {
+    if( index >= tm_message_index::Count ) { return; }
+
+    const tm_uint32 slot      = GetSlot( index );
+    const tm_uint32 slot_size = GetSlotSize( index );
+    const tm_uint32 data_size = message.GetDataSize() < slot_size ? message.GetDataSize() : slot_size;
+
+    tm_uint8 *value = reinterpret_cast<tm_uint8*>( &Values[tm_state_table_layout_of_catalog.Offsets[slot]] );
+    memcpy( value, message.GetDataPointer(), data_size );
+    if( data_size < DataSizes[slot] ) { memset( value + data_size, 0, DataSizes[slot] - data_size ); }
+
+    DataSizes[slot]         = static_cast<tm_uint8>( data_size );
+    Slots.DataTypes[slot]   = message.GetDataType();
+    Flags[slot]             = message.GetFlags();
+    Slots.UpdateTimes[slot] = SimulationTime;
+    Dirty[slot / 64]       |= tm_uint64( 1 ) << ( slot % 64 );
+  }
+
+  // all messages of one frame
+  void Update( const tm_external_message_stream &messages )
+  {
+    for( const auto message : messages ) { Update( tm_message_lookup( message.GetID() ), message ); }
+  }
+
+  //
+  // state of a slot
+  //
+  static tm_uint32 GetSlotSize( const tm_message_index index )
+  {
+    const tm_uint32 slot = GetSlot( index );
+    return ( tm_state_table_layout_of_catalog.Offsets[slot + 1] - tm_state_table_layout_of_catalog.Offsets[slot] ) * sizeof( double );
+  }
+
+  bool             HasValue( const tm_message_index index )      const { return Slots.DataTypes[GetSlot( index )] != tm_msg_data_type::None; }
+  bool             IsDirty( const tm_message_index index )       const { return ( Dirty[GetSlot( index ) / 64] >> ( GetSlot( index ) % 64 ) & 1 ) != 0; }
+  double           GetUpdateTime( const tm_message_index index ) const { return Slots.UpdateTimes[GetSlot( index )]; }     // -1 before the first update
+  tm_msg_data_type GetDataType( const tm_message_index index )   const { return Slots.DataTypes[GetSlot( index )]; }
+  tm_msg_flag_set  GetFlags( const tm_message_index index )      const { return Flags[GetSlot( index )]; }
+  tm_uint32        GetDataSize( const tm_message_index index )   const { return DataSizes[GetSlot( index )]; }
+  double           GetSimulationTime()                           const { return SimulationTime; }
+  const tm_uint64 *GetDirtyBits()                                const { return Dirty; }
+
+  // seconds since the last update, negative before the first one
+  double GetAge( const tm_message_index index ) const
+  {
+    const double time = Slots.UpdateTimes[GetSlot( index )];
+    return time < 0 ? -1 : SimulationTime - time;
+  }
+
+  //
+  // values, read as the type they were received with. vectors and strings point into the table.
+  //
+  const double *GetValues( const tm_message_index index ) const { return &Values[tm_state_table_layout_of_catalog.Offsets[GetSlot( index )]]; }
+  const char   *GetBytes( const tm_message_index index )  const { return reinterpret_cast<const char*>( GetValues( index ) ); }
+
+  // component 'i' of a numeric slot, 0 beyond the slot
+  double GetComponent( const tm_message_index index, const tm_uint32 i ) const
+  {
+    return i < GetSlotSize( index ) / sizeof( double ) ? GetValues( index )[i] : 0;
+  }
+
+  tm_int64 GetInt( const tm_message_index index ) const
+  {
+    tm_int64 value = 0;
+    if( GetSlotSize( index ) >= sizeof( value ) ) { memcpy( &value, GetValues( index ), sizeof( value ) ); }
+    return value;
+  }
+
+  double GetDouble( const tm_message_index index ) const
+  {
+    return Slots.DataTypes[GetSlot( index )] == tm_msg_data_type::Int ? static_cast<double>( GetInt( index ) ) : GetComponent( index, 0 );
+  }
+
+  tm_vector3d GetVector3d( const tm_message_index index ) const
+  {
+    return { GetComponent( index, 0 ), GetComponent( index, 1 ), GetComponent( index, 2 ) };
+  }
+
+  tm_vector4d GetVector4d( const tm_message_index index ) const
+  {
+    return { GetComponent( index, 0 ), GetComponent( index, 1 ), GetComponent( index, 2 ), GetComponent( index, 3 ) };
+  }
+
+  //
+  // calls function( index ) for every slot updated in this frame, in catalog order
+  //
+  template<typename F> void ForEachDirty( F &&function ) const
+  {
+    for( tm_uint32 w = 0; w < tm_state_table_dirty_words; ++w )
+    {
+      for( tm_uint64 bits = Dirty[w]; bits != 0; bits &= bits - 1 )
+      {
+        function( static_cast<tm_message_index>( w * 64 + std::countr_zero( bits ) ) );
+      }
+    }
+  }
+};
+
+#endif  // TM_STATE_TABLE_H
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_string_pool.h - String and String8 messages as interned ids with change events
+//
+// tm_external_message::GetString decodes a string payload into a 260 byte tm_string returned by
+// value, every frame, whether it changed or not. tm_string_tracker keeps the raw payload of every
+// String and String8 message of the catalog and compares the next one against it. Only a payload
+// that differs is decoded and interned in a tm_string_pool, which turns equal strings into the
+// same small id, and produces a tm_string_event. Consumers act on the events and compare ids
+// instead of parsing or sending the same text every frame.
+//
+// The pool is allocated in Reset() and never grows, strings that do not fit any more get id 0,
+// the empty string, and are counted. Ids stay valid until the next Reset(). A tracker or pool that
+// was never reset allocates nothing and interns every string as 0.
+//
+// String payloads are UTF-16 and decoded like tm_string, characters above 255 become '?'.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_STRING_POOL_H
+#define TM_STRING_POOL_H
+
+#include "tm_external_message_view.h"
+#include "tm_message_catalog.h"
+
+#include <memory>
+#include <string_view>
+#include <string.h>
+
+
+constexpr tm_uint32 tm_string_max_length = 64;       // the payload of a String8, a String decodes to 32 characters
+
+
+class tm_string_pool
+{
+private:
+  struct tm_string_entry
+  {
+    tm_uint32 Offset;
+    tm_uint32 Length;
+    tm_uint32 Hash;
+  };
+
+  std::unique_ptr<char[]>            Chars;
+  std::unique_ptr<tm_string_entry[]> Entries;
+  std::unique_ptr<tm_uint32[]>       Buckets;          // ids, 0 is an empty bucket
+  tm_uint32                          CharsSize   = 0;
+  tm_uint32                          CharsUsed   = 0;
+  tm_uint32                          MaxStrings  = 0;
+  tm_uint32                          NumStrings  = 0;
+  tm_uint32                          BucketMask  = 0;
+  tm_uint64                          Overflows   = 0;
+
+  static tm_uint32 GetHash( const std::string_view text )
+  {
+    tm_uint32 hash = 2166136261u;
+    for( const char c : text ) { hash = ( hash ^ static_cast<tm_uint8>( c ) ) * 16777619u; }
+    return hash;
+  }
+
+public:
+  constexpr tm_string_pool() = default;
+  tm_string_pool( const tm_string_pool & ) = delete;
+  tm_string_pool &operator=( const tm_string_pool & ) = delete;
+
+  //
+  // room for 'max_strings' strings with 'max_chars' characters in all, forgets every id
+  //
+  void Reset( const tm_uint32 max_strings, const tm_uint32 max_chars )
+  {
+    tm_uint32 num_buckets = 2;
+    while( num_buckets < 2 * ( max_strings + 1 ) ) { num_buckets *= 2; }
+
+    Chars.reset( new char[max_chars + 1] );
+    Entries.reset( new tm_string_entry[max_strings + 1] );
+    Buckets.reset( new tm_uint32[num_buckets] );
+    memset( Buckets.get(), 0, num_buckets * sizeof( tm_uint32 ) );
+
+    // id 0 is the empty string
+    Chars[0]   = 0;
+    Entries[0] = { 0, 0, GetHash( {} ) };
+    CharsSize  = max_chars + 1;
+    CharsUsed  = 1;
+    MaxStrings = max_strings;
+    NumStrings = 0;
+    BucketMask = num_buckets - 1;
+    Overflows  = 0;
+  }
+
+  //
+  // the id of 'text', the same for equal strings. 0 for the empty string and when the pool is full.
+  //
+  tm_uint32 Intern( const std::string_view text )
+  {
+    if( text.empty() || Buckets == nullptr ) { return 0; }
+
+    const tm_uint32 hash = GetHash( text );
+    tm_uint32       bucket = hash & BucketMask;
+    for( ; Buckets[bucket] != 0; bucket = ( bucket + 1 ) & BucketMask )
+    {
+      const tm_string_entry &entry = Entries[Buckets[bucket]];
+      if( entry.Hash == hash && std::string_view( &Chars[entry.Offset], entry.Length ) == text ) { return Buckets[bucket]; }
+    }
+
+    if( NumStrings == MaxStrings || CharsUsed + text.size() + 1 > CharsSize )
+    {
+      ++Overflows;
+      return 0;
+    }
+
+    // zero terminated, so the views also work as c strings
+    memcpy( &Chars[CharsUsed], text.data(), text.size() );
+    Chars[CharsUsed + text.size()] = 0;
+
+    const tm_uint32 id = ++NumStrings;
+    Entries[id]     = { CharsUsed, static_cast<tm_uint32>( text.size() ), hash };
+    Buckets[bucket] = id;
+    CharsUsed      += static_cast<tm_uint32>( text.size() ) + 1;
+    return id;
+  }
+
+  std::string_view Get( const tm_uint32 id ) const
+  {
+    if( id == 0 || id > NumStrings ) { return {}; }
+    return std::string_view( &Chars[Entries[id].Offset], Entries[id].Length );
+  }
+
+  tm_uint32 GetCount()     const { return NumStrings; }
+  tm_uint32 GetCharsUsed() const { return CharsUsed; }
+  tm_uint64 GetOverflows() const { return Overflows; }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the String and String8 messages of the catalog
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr bool tm_string_is_string_type( const tm_msg_data_type data_type )
+{
+  return data_type == tm_msg_data_type::String || data_type == tm_msg_data_type::String8;
+}
+
+struct tm_string_slots
+{
+  static constexpr tm_uint8 None = 0xff;
+
+  tm_uint8  Slots[tm_message_count] = {};          // per tm_message_index, None for other types
+  tm_uint32 Count = 0;
+};
+
+constexpr tm_string_slots tm_string_build_slots()
+{
+  tm_string_slots slots{};
+  for( tm_uint32 i = 0; i < tm_message_count; ++i )
+  {
+    slots.Slots[i] = tm_string_is_string_type( tm_message_catalog[i].DataType ) ? static_cast<tm_uint8>( slots.Count++ ) : tm_string_slots::None;
+  }
+  return slots;
+}
+
+inline constexpr tm_string_slots tm_string_slots_of_catalog = tm_string_build_slots();
+
+constexpr tm_uint32 tm_string_message_count = tm_string_slots_of_catalog.Count;
+
+static_assert( tm_string_message_count < tm_string_slots::None, "too many string messages for tm_string_slots" );
+
+//
+// decodes a String or String8 payload into 'text', at most tm_string_max_length characters
+//
+inline tm_uint32 tm_string_decode( const tm_msg_data_type data_type, const tm_uint8 *data, const tm_uint32 data_size, char *text )
+{
+  tm_uint32 length = 0;
+  if( data_type == tm_msg_data_type::String )
+  {
+    for( tm_uint32 i = 0; i + sizeof( tm_chartype ) <= data_size && length < tm_string_max_length; i += sizeof( tm_chartype ) )
+    {
+      tm_chartype c;
+      memcpy( &c, data + i, sizeof( c ) );
+      if( c == 0 ) { break; }
+      text[length++] = c < 256 ? static_cast<char>( c ) : '?';
+    }
+  }
+  else if( data_type == tm_msg_data_type::String8 )
+  {
+    while( length < data_size && length < tm_string_max_length && data[length] != 0 ) { text[length] = static_cast<char>( data[length] ); ++length; }
+  }
+
+  return length;
+}
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_string_tracker - called on the simulation thread only
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+struct tm_string_event
+{
+  tm_message_index Index;
+  tm_uint32        Previous;     // ids in the pool of the tracker, 0 before the first message
+  tm_uint32        Current;
+};
+
+class tm_string_tracker
+{
+private:
+  struct tm_string_slot
+  {
+    tm_uint8         Raw[tm_string_max_length] = {};
+    tm_uint8         Size       = 0;
+    tm_msg_data_type DataType   = tm_msg_data_type::None;
+    tm_uint32        ID         = 0;
+    tm_uint64        EventFrame = 0;     // the frame of the last event, 0 for none
+    tm_uint32        Event      = 0;     // its position in Events
+  };
+
+  tm_string_slot  Slots[tm_string_message_count];
+  tm_string_event Events[tm_string_message_count] = {};
+  tm_uint32       NumEvents = 0;
+  tm_uint64       Frame     = 1;
+  tm_uint64       Changes   = 0;
+  tm_string_pool  Pool;
+
+  // keeps the order of the other events
+  void RemoveEvent( tm_string_slot &slot )
+  {
+    for( tm_uint32 i = slot.Event + 1; i < NumEvents; ++i )
+    {
+      Events[i - 1] = Events[i];
+      Slots[tm_string_slots_of_catalog.Slots[static_cast<tm_uint32>( Events[i - 1].Index )]].Event = i - 1;
+    }
+
+    --NumEvents;
+    slot.EventFrame = 0;
+  }
+
+public:
+  // constexpr so a global tracker is constant initialized, the pool is allocated in Reset()
+  constexpr tm_string_tracker() = default;
+
+  // forgets every string, the pool gets room for 'max_strings' with 'max_chars' characters
+  void Reset( const tm_uint32 max_strings, const tm_uint32 max_chars )
+  {
+    for( auto &slot : Slots ) { slot = tm_string_slot(); }
+    NumEvents = 0;
+    Frame     = 1;
+    Changes   = 0;
+    Pool.Reset( max_strings, max_chars );
+  }
+
+  // the events of the previous frame are gone afterwards
+  void BeginFrame()
+  {
+    NumEvents = 0;
+    ++Frame;
+  }
+
+  //
+  // compares the payload of a String or String8 message with the last one and interns it when it
+  // differs. returns true for a change, other messages are ignored.
+  //
+  bool Update( const tm_message_index index, const tm_external_message_view message )
+  {
+    if( index >= tm_message_index::Count ) { return false; }
+
+    const tm_uint8         slot_index = tm_string_slots_of_catalog.Slots[static_cast<tm_uint32>( index )];
+    const tm_msg_data_type data_type  = message.GetDataType();
+    if( slot_index == tm_string_slots::None || !tm_string_is_string_type( data_type ) ) { return false; }
+
+    tm_string_slot &slot      = Slots[slot_index];
+    const tm_uint32 data_size = message.GetDataSize() < tm_string_max_length ? message.GetDataSize() : tm_string_max_length;
+    if( slot.DataType == data_type && slot.Size == data_size && memcmp( slot.Raw, message.GetDataPointer(), data_size ) == 0 ) { return false; }
+
+    memcpy( slot.Raw, message.GetDataPointer(), data_size );
+    slot.Size     = static_cast<tm_uint8>( data_size );
+    slot.DataType = data_type;
+
+    char            text[tm_string_max_length];
+    const tm_uint32 length = tm_string_decode( data_type, slot.Raw, data_size, text );
+    const tm_uint32 id     = Pool.Intern( std::string_view( text, length ) );
+
+    // the raw bytes may differ behind the terminating zero while the text stays the same
+    if( id == slot.ID ) { return false; }
+
+    // one event per message and frame, from the first to the last string, none when it leads back
+    if( slot.EventFrame == Frame && Events[slot.Event].Previous == id )
+    {
+      RemoveEvent( slot );
+    }
+    else if( slot.EventFrame == Frame )
+    {
+      Events[slot.Event].Current = id;
+    }
+    else
+    {
+      slot.EventFrame     = Frame;
+      slot.Event          = NumEvents;
+      Events[NumEvents++] = { index, slot.ID, id };
+    }
+
+    slot.ID = id;
+    ++Changes;
+    return true;
+  }
+
+  // all messages of one frame
+  void Update( const tm_external_message_stream &messages )
+  {
+    for( const auto message : messages ) { Update( tm_message_lookup( message.GetID() ), message ); }
+  }
+
+  //
+  // the current string of a message, empty for other messages and before the first one
+  //
+  tm_uint32 GetID( const tm_message_index index ) const
+  {
+    const tm_uint8 slot_index = index < tm_message_index::Count ? tm_string_slots_of_catalog.Slots[static_cast<tm_uint32>( index )] : tm_string_slots::None;
+    return slot_index != tm_string_slots::None ? Slots[slot_index].ID : 0;
+  }
+
+  std::string_view GetString( const tm_message_index index ) const { return Pool.Get( GetID( index ) ); }
+
+  //
+  // the changes since BeginFrame(), in the order the messages first changed. a message that
+  // changes twice in one frame has one event, and none when it leads back to the string it started
+  // with.
+  //
+  const tm_string_event *GetEvents()    const { return Events; }
+  tm_uint32              GetNumEvents() const { return NumEvents; }
+  tm_uint64              GetChanges()   const { return Changes; }
+
+  const tm_string_pool &GetPool() const { return Pool; }
+};
+
+#endif  // TM_STRING_POOL_H
@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_string_reporter.h - logs and sends the string changes of tm_string_pool.h
+//
+// The simulation thread copies the events of a frame and their text into a byte ring, a reporter
+// thread formats them, writes them to the log and sends them as one datagram per frame:
+//
+//   string_changes time=<simulation time>
+//   <message name> <text>
+//   ...
+//
+// Frames that do not fit into the ring are dropped and counted.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_STRING_REPORTER_H
+#define TM_STRING_REPORTER_H
+
+#include "tm_platform.h"
+#include "tm_spsc_byte_ring.h"
+#include "tm_string_pool.h"
+#include "tm_udp_sender.h"
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+#include <string.h>
+
+
+class tm_string_reporter
+{
+private:
+  // a record is the header and per event the message index, the length and the text
+  struct tm_record_header
+  {
+    double    SimulationTime;
+    tm_uint32 NumEvents;
+  };
+
+  static constexpr tm_uint32 MaxEventSize = sizeof( tm_uint16 ) + sizeof( tm_uint8 ) + tm_string_max_length;
+
+  tm_spsc_byte_ring Ring;
+  tm_udp_sender     Sender;
+  std::thread       Thread;
+  std::atomic<bool> Running{ false };
+  bool              Log = false;
+
+  // reporter thread only, Push() never makes a larger record
+  tm_uint8          Record[sizeof( tm_record_header ) + tm_string_message_count * MaxEventSize];
+  char              Text[4096];
+
+  void Report( const tm_uint32 size )
+  {
+    tm_record_header header;
+    memcpy( &header, Record, sizeof( header ) );
+
+    int length = snprintf( Text, sizeof( Text ), "string_changes time=%.3f\n", header.SimulationTime );
+
+    tm_uint32 pos = sizeof( header );
+    for( tm_uint32 i = 0; i < header.NumEvents && pos + sizeof( tm_uint16 ) + sizeof( tm_uint8 ) <= size; ++i )
+    {
+      tm_uint16 index;
+      memcpy( &index, Record + pos, sizeof( index ) );
+      const tm_uint8 string_length = Record[pos + sizeof( index )];
+      const char    *string        = reinterpret_cast<const char*>( Record + pos + sizeof( index ) + 1 );
+      const char    *name          = tm_message_catalog_get_name( tm_message_catalog[index] );
+      pos += sizeof( index ) + 1 + string_length;
+
+      if( Log ) { tm_platform_log( "%s '%.*s'", name, static_cast<int>( string_length ), string ); }
+
+      const int line = snprintf( Text + length, sizeof( Text ) - length, "%s %.*s\n", name, static_cast<int>( string_length ), string );
+      if( line < 0 || length + line >= static_cast<int>( sizeof( Text ) ) ) { break; }
+      length += line;
+    }
+
+    if( Sender.IsOpen() ) { Sender.Send( Text, static_cast<tm_uint32>( length ) ); }
+  }
+
+  void Run()
+  {
+    for( ;; )
+    {
+      const tm_uint32 signal = Ring.GetSignal();
+
+      tm_uint32 size = 0;
+      while( Ring.Peek( size ) )
+      {
+        Ring.Pop( Record, size );
+        Report( size );
+      }
+
+      if( !Running.load( std::memory_order_acquire ) ) { break; }
+
+      Ring.WaitForData( signal );
+    }
+  }
+
+public:
+  tm_string_reporter() = default;
+  tm_string_reporter( const tm_string_reporter & ) = delete;
+  tm_string_reporter &operator=( const tm_string_reporter & ) = delete;
+  ~tm_string_reporter() { Stop(); }
+
+  //
+  // starts the reporter thread, it logs the changes with 'log' and sends them to 'host' and
+  // 'service' unless 'host' is empty. 'buffer_size' bytes are buffered between the threads.
+  //
+  bool Start( const bool log, const char *host, const char *service, const tm_uint64 buffer_size )
+  {
+    Stop();
+
+    Log = log;
+    if( host[0] != 0 && !Sender.Open( host, service ) ) { tm_platform_log( "cannot send string changes to %s:%s", host, service ); }
+    if( !Log && !Sender.IsOpen() ) { return false; }
+
+    Ring.Reset( buffer_size );
+
+    Running.store( true, std::memory_order_release );
+    Thread = std::thread( &tm_string_reporter::Run, this );
+    return true;
+  }
+
+  //
+  // reports the remaining changes and closes the socket
+  //
+  void Stop()
+  {
+    if( Thread.joinable() )
+    {
+      Running.store( false, std::memory_order_release );
+      Ring.Wake();
+      Thread.join();
+    }
+
+    Sender.Close();
+  }
+
+  bool IsRunning() const { return Running.load( std::memory_order_relaxed ); }
+
+  //
+  // called on the simulation thread after the messages of a frame went through 'tracker', copies
+  // the events and their text and never blocks
+  //
+  bool Push( const double simulation_time, const tm_string_tracker &tracker )
+  {
+    if( !IsRunning() || tracker.GetNumEvents() == 0 ) { return false; }
+
+    const tm_record_header header = { simulation_time, tracker.GetNumEvents() };
+    tm_uint8               events[tm_string_message_count * MaxEventSize];
+    tm_uint32              size = 0;
+
+    for( tm_uint32 i = 0; i < tracker.GetNumEvents(); ++i )
+    {
+      const tm_string_event &event  = tracker.GetEvents()[i];
+      const std::string_view string = tracker.GetPool().Get( event.Current );
+      const tm_uint16        index  = static_cast<tm_uint16>( event.Index );
+      const tm_uint8         length = static_cast<tm_uint8>( string.size() < tm_string_max_length ? string.size() : tm_string_max_length );
+
+      memcpy( events + size, &index, sizeof( index ) );
+      events[size + sizeof( index )] = length;
+      memcpy( events + size + sizeof( index ) + 1, string.data(), length );
+      size += sizeof( index ) + 1 + length;
+    }
+
+    return Ring.Push( &header, sizeof( header ), events, size );
+  }
+
+  tm_uint64 GetDropped() const { return Ring.GetDropped(); }
+};
+
+#endif  // TM_STRING_REPORTER_H
@@ -0,0 +1,584 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_telemetry_config.h - settings of the telemetry dll
+//
+// The settings are read once in Aerofly_FS_2_External_DLL_Init from a plain text file next to the
+// dll with the same name and the extension .cfg, e.g. Aerofly_FS_2_GamePlugin_Telemetry.cfg.
+// The environment variable AEROFLY_FS_2_TELEMETRY_CONFIG overrides the location.
+//
+// Every line has the form "key = value", everything after a '#' is a comment. A missing file
+// keeps the defaults, which match the behavior of the original dll.
+//
+//   format                = csv | binary | binary_float    default format of the destinations
+//   queue_size            = 16                             frames buffered between simulation and sender thread
+//   queue_full            = drop_oldest | drop_newest      what to do when the sender thread falls behind
+//   channel               = <name> [scale=1] [offset=0] [wrap=0] [frame=global] [epsilon=0]
+//   destination           = <host>:<port> [format=<format>] [rate=0] [channels=<list>] [keyframe=0]
+//   multicast_ttl         = 1                              hop limit of multicast destinations
+//   local_frame_threshold = 100                            meters moved before the local frame is computed again
+//   record                = <path>                         records the received byte streams, see below
+//   record_buffer         = 8                              megabytes buffered between simulation and writer
+//   load_factor           = off | on                       appends the g values of tm_specific_force.h
+//   washout               = off | on                       appends the motion cues of tm_washout_filter.h
+//   washout_surge         = 0.3                            high-pass corner frequencies in Hz
+//   washout_sway          = 0.3
+//   washout_heave         = 0.5
+//   washout_yaw           = 0.2
+//   washout_tilt          = 0.2                            low-pass corner of the tilt coordination in Hz
+//   washout_tilt_rate     = 3                              tilt rate limit in degrees per second, 0 is off
+//   output_rate           = 0                              frames per second sent at a fixed rate, 0 sends every Update
+//   output_delay          = auto | <ms>                    how far the fixed rate frames lag the simulation
+//   output_extrapolation  = 100                            milliseconds of dead reckoning before values hold
+//   shared_memory         = <name>                         also publishes every frame in shared memory, see below
+//   shared_memory_slots   = 64                             frames the shared memory ring holds
+//   command               = <host>:<port>                  receives commands for the simulation, see below
+//   command_queue_size    = 256                            commands buffered between listener and Update
+//   stage_stats           = 0                              seconds between two stage timing reports, 0 is off
+//   stage_stats_address   = <host>:<port>                  sends the reports as text datagrams
+//   stage_stats_file      = <path>                         appends the reports to a file
+//   stall_threshold       = 50                             milliseconds of delta_time that count as a stall, 0 is off
+//   string_changes        = off | log | <host>:<port>      reports the changes of String and String8 messages
+//
+// Every channel line forwards one message of MESSAGE_LIST, e.g. "channel = Aircraft.OnGround".
+// The values are sent in the order of the lines, vectors as one value per component. Each value
+// is sent as value * scale + offset, wrap moves raw values above wrap / 2 down by wrap. Global
+// vectors such as Aircraft.Velocity or Aircraft.Wind can be sent in the local frame at the
+// aircraft position with frame=enu (east, north, up) or frame=ned (north, east, down). epsilon is
+// the smallest change, in sent units, that destinations with delta frames send. Without channel
+// lines the channels of the original dll are sent. A channel whose message is not received in an
+// Update keeps its last value, see tm_state_table.h.
+//
+// Every destination line adds a unicast or multicast receiver, e.g.
+// "destination = 239.255.0.1:4124 format=binary rate=30 channels=0-5,9". rate limits the frames
+// per second, 0 sends every frame. channels selects values by their position, the default is all
+// of them. IPv6 addresses are written in brackets, [::1]:4123. Without destination lines frames
+// go to 127.0.0.1:4123 like in the original dll. keyframe=N, with a binary format, sends a full
+// frame every N frames and only the changed channels in between, see tm_telemetry_frame.h.
+//
+// With load_factor = on three values are appended after the channels: the longitudinal, lateral
+// and vertical specific force in g, derived from Aircraft.Velocity every frame. With washout = on
+// six more follow: surge, sway, heave, tilt pitch, tilt roll and yaw, computed every Update with
+// the real delta_time.
+//
+// With output_rate set, e.g. to 1000, the sender thread sends frames at that rate instead of one per
+// Update. They are interpolated between the last two simulation frames and dead-reckoned when the
+// next one is late, see tm_output_scheduler.h. output_delay = auto lags by one simulation frame,
+// which leaves room to interpolate, 0 always dead-reckons from the latest frame.
+//
+// With a shared memory name, e.g. "shared_memory = Aerofly_FS_2_Telemetry", every frame is also
+// published to consumers on the same machine through shared memory, with all values as doubles
+// and without the rate limit of the destinations, see shared/telemetry/tm_telemetry_shm.h.
+// Without destination lines nothing is sent to 127.0.0.1:4123 then.
+//
+// With a command address, e.g. "command = 127.0.0.1:4130", external tools send lines like
+// "Controls.Throttle1 0.8" there and Update hands them to the simulation, see tm_command_listener.h.
+// Only messages with Write or ReadWrite access are accepted. Bind to a loopback address unless
+// other machines should control the simulation.
+//
+// With stage_stats set, Update and the sender thread time their stages into histograms and the
+// percentiles of every interval go to the destination, the file or else the log, see
+// tm_stage_stats.h. A summary of the session is logged at shutdown.
+//
+// The delta_time of every Update goes into a histogram, see tm_frame_pacing.h. One above
+// stall_threshold is logged and the next frame carries the Stall flag of tm_telemetry_frame.h,
+// binary formats only. The distribution and the stalls of the session are logged at shutdown.
+//
+// With string_changes set, Update interns the String and String8 messages, e.g. Aircraft.Name or
+// Autopilot.ArmedApproachMode, and reports the ones that changed in a frame as lines of name and
+// text, to the log or as one text datagram per frame, see tm_string_pool.h and
+// tm_string_reporter.h. Unchanged strings are neither decoded nor reported again.
+//
+// The record path may contain strftime conversions, e.g. "record = C:\logs\%Y%m%d_%H%M%S.afrl",
+// so every session gets its own file. The format is described in shared/telemetry/tm_frame_log.h.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_TELEMETRY_CONFIG_H
+#define TM_TELEMETRY_CONFIG_H
+
+#include "tm_channel_plan.h"
+#include "tm_platform.h"
+#include "tm_spsc_queue.h"
+#include "tm_washout_filter.h"
+#include "../shared/telemetry/tm_telemetry_frame.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+constexpr tm_uint32 tm_telemetry_max_destinations = 8;
+
+struct tm_telemetry_destination
+{
+  char                Host[128]     = "127.0.0.1";
+  char                Service[16]   = "4123";
+  tm_telemetry_format Format        = tm_telemetry_format::CSV;
+  bool                DefaultFormat = true;     // take the format setting instead of Format
+  double              MaxRate       = 0;        // frames per second, 0 sends every frame
+  tm_uint32           Keyframe      = 0;        // frames from one keyframe to the next, 0 sends no delta frames
+  tm_uint64           ChannelMask[tm_telemetry_channel_mask_words] = { ~tm_uint64( 0 ), ~tm_uint64( 0 ) };
+};
+
+static_assert( tm_telemetry_channel_mask_words == 2, "update the default channel mask of tm_telemetry_destination" );
+
+
+class tm_telemetry_config
+{
+public:
+  tm_telemetry_format  Format          = tm_telemetry_format::CSV;
+  tm_uint32            QueueSize       = 16;
+  tm_queue_full_policy QueueFullPolicy = tm_queue_full_policy::DropOldest;
+
+  tm_channel_subscription Channels[tm_telemetry_max_channels];
+  tm_uint32               NumChannels      = 0;
+  tm_uint32               NumChannelValues = 0;
+
+  tm_telemetry_destination Destinations[tm_telemetry_max_destinations];
+  tm_uint32                NumDestinations     = 0;
+  tm_uint32                MulticastTTL        = 1;
+  double                   LocalFrameThreshold = 100;   // meters
+
+  char                     RecordPath[512]  = {};
+  tm_uint32                RecordBufferSize = 8;
+
+  bool                     LoadFactor = false;
+  tm_washout_settings      Washout;
+
+  double                   OutputRate          = 0;       // frames per second, 0 sends every Update
+  double                   OutputDelay         = -1;      // seconds, negative for one simulation frame
+  double                   OutputExtrapolation = 0.1;     // seconds
+
+  char                     SharedMemoryName[128]  = {};   // empty without shared memory
+  tm_uint32                SharedMemorySlots      = 64;
+
+  double                   StageStatsInterval        = 0;    // seconds, 0 turns the probes off
+  char                     StageStatsHost[128]       = {};
+  char                     StageStatsService[16]     = {};
+  char                     StageStatsPath[512]       = {};
+
+  double                   StallThreshold = 0.05;         // seconds, 0 detects no stalls
+
+  bool                     StringChangesLog         = false;
+  char                     StringChangesHost[128]   = {};  // empty without string change datagrams
+  char                     StringChangesService[16] = {};
+
+  char                     CommandHost[128]    = {};      // empty without a command listener
+  char                     CommandService[16]  = {};
+  tm_uint32                CommandQueueSize    = 256;
+
+public:
+  //
+  // returns the path of the config file, next to the dll or from the environment
+  //
+  static bool GetDefaultPath( const HINSTANCE module, char *path, const unsigned int path_size )
+  {
+    const char *environment = getenv( "AEROFLY_FS_2_TELEMETRY_CONFIG" );
+    if( environment != nullptr && environment[0] != 0 )
+    {
+      return snprintf( path, path_size, "%s", environment ) < static_cast<int>( path_size );
+    }
+
+    if( !tm_platform_get_module_path( module, path, path_size ) ) { return false; }
+
+    char *extension = strrchr( path, '.' );
+    char *separator = strrchr( path, '/' ) > strrchr( path, '\\' ) ? strrchr( path, '/' ) : strrchr( path, '\\' );
+    if( extension == nullptr || extension < separator ) { extension = path + strlen( path ); }
+    if( extension + 5 > path + path_size ) { return false; }
+
+    memcpy( extension, ".cfg", 5 );
+    return true;
+  }
+
+  //
+  // reads the file, returns false if it could not be opened. invalid lines are reported and skipped.
+  //
+  bool Load( const char *path )
+  {
+    FILE *file = fopen( path, "r" );
+    if( file == nullptr ) { return false; }
+
+    char line[512];
+    for( int line_number = 1; fgets( line, sizeof( line ), file ) != nullptr; ++line_number )
+    {
+      char *comment = strchr( line, '#' );
+      if( comment != nullptr ) { *comment = 0; }
+
+      char *key = Trim( line );
+      if( key[0] == 0 ) { continue; }
+
+      char *separator = strchr( key, '=' );
+      if( separator == nullptr )
+      {
+        tm_platform_log( "%s(%d): expected 'key = value'", path, line_number );
+        continue;
+      }
+
+      *separator = 0;
+      key = Trim( key );
+      char *value = Trim( separator + 1 );
+
+      const char *error = ParseSetting( key, value );
+      if( error != nullptr )
+      {
+        tm_platform_log( "%s(%d): %s '%s = %s'", path, line_number, error, key, value );
+      }
+    }
+
+    fclose( file );
+    return true;
+  }
+
+private:
+  static char *Trim( char *s )
+  {
+    while( isspace( static_cast<unsigned char>( *s ) ) ) { ++s; }
+    char *end = s + strlen( s );
+    while( end > s && isspace( static_cast<unsigned char>( end[-1] ) ) ) { --end; }
+    *end = 0;
+    return s;
+  }
+
+  static bool ParseUnsigned( const char *value, tm_uint32 &result, const tm_uint32 min, const tm_uint32 max )
+  {
+    char *end = nullptr;
+    const unsigned long v = strtoul( value, &end, 10 );
+    if( end == value || *end != 0 || v < min || v > max ) { return false; }
+    result = static_cast<tm_uint32>( v );
+    return true;
+  }
+
+  static bool ParseDouble( const char *value, double &result )
+  {
+    char *end = nullptr;
+    const double v = strtod( value, &end );
+    if( end == value || *end != 0 ) { return false; }
+    result = v;
+    return true;
+  }
+
+  static bool ParseFormat( const char *value, tm_telemetry_format &format )
+  {
+    if( strcmp( value, "csv" ) == 0 )          { format = tm_telemetry_format::CSV;         return true; }
+    if( strcmp( value, "binary" ) == 0 )       { format = tm_telemetry_format::Binary;      return true; }
+    if( strcmp( value, "binary_float" ) == 0 ) { format = tm_telemetry_format::BinaryFloat; return true; }
+    return false;
+  }
+
+  // "0-5,9", positions of the values in the channel list
+  static bool ParseChannelMask( const char *value, tm_uint64 *mask )
+  {
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w ) { mask[w] = 0; }
+
+    for( const char *p = value; ; ++p )
+    {
+      char *end = nullptr;
+      const unsigned long first = strtoul( p, &end, 10 );
+      unsigned long       last  = first;
+      if( end == p ) { return false; }
+
+      if( *end == '-' )
+      {
+        p    = end + 1;
+        last = strtoul( p, &end, 10 );
+        if( end == p ) { return false; }
+      }
+
+      if( first > last || last >= tm_telemetry_max_channels ) { return false; }
+      for( unsigned long i = first; i <= last; ++i ) { mask[i / 64] |= tm_uint64( 1 ) << ( i % 64 ); }
+
+      if( *end == 0 ) { return true; }
+      if( *end != ',' ) { return false; }
+      p = end;
+    }
+  }
+
+  // "<host>:<port>" or "[<ipv6 address>]:<port>"
+  template<size_t host_size, size_t service_size> static const char *ParseAddress( char *address, char ( &host )[host_size], char ( &service )[service_size] )
+  {
+    if( address == nullptr ) { return "missing address"; }
+
+    char *port = strrchr( address, ':' );
+    if( port == nullptr || port[1] == 0 ) { return "expected '<host>:<port>'"; }
+    *port++ = 0;
+
+    // [::1]:4123
+    if( address[0] == '[' )
+    {
+      const size_t length = strlen( address );
+      if( length < 3 || address[length - 1] != ']' ) { return "expected '[<ipv6 address>]:<port>'"; }
+      address[length - 1] = 0;
+      ++address;
+    }
+
+    if( snprintf( host, host_size, "%s", address ) >= static_cast<int>( host_size ) ||
+        snprintf( service, service_size, "%s", port ) >= static_cast<int>( service_size ) )
+    {
+      return "invalid address";
+    }
+
+    return nullptr;
+  }
+
+  // "<host>:<port> [format=] [rate=] [channels=] [keyframe=]"
+  const char *ParseDestination( const char *value )
+  {
+    if( NumDestinations == tm_telemetry_max_destinations ) { return "too many destinations"; }
+
+    char buffer[256];
+    if( snprintf( buffer, sizeof( buffer ), "%s", value ) >= static_cast<int>( sizeof( buffer ) ) ) { return "invalid setting"; }
+
+    char                    *context = buffer;
+    tm_telemetry_destination destination;
+    const char *error = ParseAddress( tm_platform_next_token( context ), destination.Host, destination.Service );
+    if( error != nullptr ) { return error; }
+
+    for( const char *option = tm_platform_next_token( context ); option != nullptr; option = tm_platform_next_token( context ) )
+    {
+      bool valid = false;
+      if( strncmp( option, "format=", 7 ) == 0 )
+      {
+        valid = ParseFormat( option + 7, destination.Format );
+        destination.DefaultFormat = false;
+      }
+      else if( strncmp( option, "rate=", 5 ) == 0 )     { valid = ParseDouble( option + 5, destination.MaxRate ) && destination.MaxRate >= 0; }
+      else if( strncmp( option, "channels=", 9 ) == 0 ) { valid = ParseChannelMask( option + 9, destination.ChannelMask ); }
+      else if( strncmp( option, "keyframe=", 9 ) == 0 ) { valid = ParseUnsigned( option + 9, destination.Keyframe, 0, 100000 ); }
+      if( !valid ) { return "invalid destination option"; }
+    }
+
+    if( destination.Keyframe > 0 && !destination.DefaultFormat && destination.Format == tm_telemetry_format::CSV ) { return "delta frames need a binary format"; }
+
+    Destinations[NumDestinations++] = destination;
+    return nullptr;
+  }
+
+  static bool ParseChannelFrame( const char *value, tm_channel_frame &frame )
+  {
+    if( strcmp( value, "global" ) == 0 ) { frame = tm_channel_frame::Global; return true; }
+    if( strcmp( value, "enu" ) == 0 )    { frame = tm_channel_frame::ENU;    return true; }
+    if( strcmp( value, "ned" ) == 0 )    { frame = tm_channel_frame::NED;    return true; }
+    return false;
+  }
+
+  // "<name> [scale=1] [offset=0] [wrap=0] [frame=global] [epsilon=0]", the name is resolved here so typos show up at load
+  const char *ParseChannel( const char *value )
+  {
+    char buffer[256];
+    if( snprintf( buffer, sizeof( buffer ), "%s", value ) >= static_cast<int>( sizeof( buffer ) ) ) { return "invalid setting"; }
+
+    char *context = buffer;
+    const char *name = tm_platform_next_token( context );
+    if( name == nullptr ) { return "missing message name"; }
+
+    tm_channel_subscription subscription;
+    subscription.Index = tm_message_catalog_find_index( name );
+    if( subscription.Index == tm_message_index::Count ) { return "unknown message name"; }
+
+    const tm_uint32 num_values = tm_channel_get_value_count( tm_message_catalog_find( subscription.Index )->DataType );
+    if( num_values == 0 ) { return "message has no numeric value"; }
+    if( NumChannels == tm_telemetry_max_channels || NumChannelValues + num_values > tm_telemetry_max_channels ) { return "too many channels"; }
+
+    for( const char *option = tm_platform_next_token( context ); option != nullptr; option = tm_platform_next_token( context ) )
+    {
+      bool valid = false;
+      if(      strncmp( option, "scale=", 6 ) == 0 )   { valid = ParseDouble( option + 6, subscription.Scale ); }
+      else if( strncmp( option, "offset=", 7 ) == 0 )  { valid = ParseDouble( option + 7, subscription.Offset ); }
+      else if( strncmp( option, "wrap=", 5 ) == 0 )    { valid = ParseDouble( option + 5, subscription.Wrap ); }
+      else if( strncmp( option, "frame=", 6 ) == 0 )   { valid = ParseChannelFrame( option + 6, subscription.Frame ); }
+      else if( strncmp( option, "epsilon=", 8 ) == 0 ) { valid = ParseDouble( option + 8, subscription.Epsilon ) && subscription.Epsilon >= 0; }
+      if( !valid ) { return "invalid channel option"; }
+    }
+
+    if( subscription.Frame != tm_channel_frame::Global && num_values != 3 ) { return "only vectors can be sent in a local frame"; }
+
+    Channels[NumChannels++] = subscription;
+    NumChannelValues += num_values;
+    return nullptr;
+  }
+
+  // returns nullptr or what is wrong with the setting
+  const char *ParseSetting( const char *key, const char *value )
+  {
+    if( strcmp( key, "format" ) == 0 )
+    {
+      return ParseFormat( value, Format ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "queue_size" ) == 0 )
+    {
+      return ParseUnsigned( value, QueueSize, 2, 4096 ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "queue_full" ) == 0 )
+    {
+      if( strcmp( value, "drop_oldest" ) == 0 ) { QueueFullPolicy = tm_queue_full_policy::DropOldest; return nullptr; }
+      if( strcmp( value, "drop_newest" ) == 0 ) { QueueFullPolicy = tm_queue_full_policy::DropNewest; return nullptr; }
+      return "invalid setting";
+    }
+
+    if( strcmp( key, "channel" ) == 0 )
+    {
+      return ParseChannel( value );
+    }
+
+    if( strcmp( key, "destination" ) == 0 )
+    {
+      return ParseDestination( value );
+    }
+
+    if( strcmp( key, "record" ) == 0 )
+    {
+      return snprintf( RecordPath, sizeof( RecordPath ), "%s", value ) < static_cast<int>( sizeof( RecordPath ) ) ? nullptr : "path is too long";
+    }
+
+    if( strcmp( key, "record_buffer" ) == 0 )
+    {
+      return ParseUnsigned( value, RecordBufferSize, 1, 1024 ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "multicast_ttl" ) == 0 )
+    {
+      return ParseUnsigned( value, MulticastTTL, 1, 255 ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "local_frame_threshold" ) == 0 )
+    {
+      double threshold = 0;
+      if( !ParseDouble( value, threshold ) || threshold < 0 ) { return "invalid setting"; }
+      LocalFrameThreshold = threshold;
+      return nullptr;
+    }
+
+    if( strcmp( key, "load_factor" ) == 0 )
+    {
+      if( strcmp( value, "on" ) == 0 )  { LoadFactor = true;  return nullptr; }
+      if( strcmp( value, "off" ) == 0 ) { LoadFactor = false; return nullptr; }
+      return "invalid setting";
+    }
+
+    if( strcmp( key, "washout" ) == 0 )
+    {
+      if( strcmp( value, "on" ) == 0 )  { Washout.Enabled = true;  return nullptr; }
+      if( strcmp( value, "off" ) == 0 ) { Washout.Enabled = false; return nullptr; }
+      return "invalid setting";
+    }
+
+    double *washout_value = strcmp( key, "washout_surge" ) == 0     ? &Washout.SurgeCutoff
+                          : strcmp( key, "washout_sway" ) == 0      ? &Washout.SwayCutoff
+                          : strcmp( key, "washout_heave" ) == 0     ? &Washout.HeaveCutoff
+                          : strcmp( key, "washout_yaw" ) == 0       ? &Washout.YawCutoff
+                          : strcmp( key, "washout_tilt" ) == 0      ? &Washout.TiltCutoff
+                          : strcmp( key, "washout_tilt_rate" ) == 0 ? &Washout.TiltRateLimit
+                          : nullptr;
+    if( washout_value != nullptr )
+    {
+      double v = 0;
+      if( !ParseDouble( value, v ) || v < 0 ) { return "invalid setting"; }
+      *washout_value = v;
+      return nullptr;
+    }
+
+    if( strcmp( key, "output_rate" ) == 0 )
+    {
+      double rate = 0;
+      if( !ParseDouble( value, rate ) || rate < 0 || rate > 10000 ) { return "invalid setting"; }
+      OutputRate = rate;
+      return nullptr;
+    }
+
+    if( strcmp( key, "output_delay" ) == 0 )
+    {
+      if( strcmp( value, "auto" ) == 0 ) { OutputDelay = -1; return nullptr; }
+
+      double milliseconds = 0;
+      if( !ParseDouble( value, milliseconds ) || milliseconds < 0 ) { return "invalid setting"; }
+      OutputDelay = milliseconds * 0.001;
+      return nullptr;
+    }
+
+    if( strcmp( key, "shared_memory" ) == 0 )
+    {
+      if( value[0] == 0 || strpbrk( value, "/\\ \t" ) != nullptr ) { return "invalid shared memory name"; }
+      return snprintf( SharedMemoryName, sizeof( SharedMemoryName ), "%s", value ) < static_cast<int>( sizeof( SharedMemoryName ) ) ? nullptr : "name is too long";
+    }
+
+    if( strcmp( key, "shared_memory_slots" ) == 0 )
+    {
+      return ParseUnsigned( value, SharedMemorySlots, 2, 65536 ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "stage_stats" ) == 0 )
+    {
+      double seconds = 0;
+      if( !ParseDouble( value, seconds ) || seconds < 0 ) { return "invalid setting"; }
+      StageStatsInterval = seconds;
+      return nullptr;
+    }
+
+    if( strcmp( key, "stage_stats_address" ) == 0 )
+    {
+      char buffer[256];
+      if( snprintf( buffer, sizeof( buffer ), "%s", value ) >= static_cast<int>( sizeof( buffer ) ) ) { return "invalid setting"; }
+      const char *error = ParseAddress( buffer, StageStatsHost, StageStatsService );
+      if( error != nullptr ) { StageStatsHost[0] = 0; }
+      return error;
+    }
+
+    if( strcmp( key, "stage_stats_file" ) == 0 )
+    {
+      return snprintf( StageStatsPath, sizeof( StageStatsPath ), "%s", value ) < static_cast<int>( sizeof( StageStatsPath ) ) ? nullptr : "path is too long";
+    }
+
+    if( strcmp( key, "stall_threshold" ) == 0 )
+    {
+      double milliseconds = 0;
+      if( !ParseDouble( value, milliseconds ) || milliseconds < 0 ) { return "invalid setting"; }
+      StallThreshold = milliseconds * 1e-3;
+      return nullptr;
+    }
+
+    if( strcmp( key, "string_changes" ) == 0 )
+    {
+      StringChangesLog     = false;
+      StringChangesHost[0] = 0;
+      if( strcmp( value, "off" ) == 0 ) { return nullptr; }
+      if( strcmp( value, "log" ) == 0 ) { StringChangesLog = true; return nullptr; }
+
+      char buffer[256];
+      if( snprintf( buffer, sizeof( buffer ), "%s", value ) >= static_cast<int>( sizeof( buffer ) ) ) { return "invalid setting"; }
+      const char *error = ParseAddress( buffer, StringChangesHost, StringChangesService );
+      if( error != nullptr ) { StringChangesHost[0] = 0; }
+      return error;
+    }
+
+    if( strcmp( key, "command" ) == 0 )
+    {
+      char buffer[256];
+      if( snprintf( buffer, sizeof( buffer ), "%s", value ) >= static_cast<int>( sizeof( buffer ) ) ) { return "invalid setting"; }
+      char       *context = buffer;
+      const char *error   = ParseAddress( tm_platform_next_token( context ), CommandHost, CommandService );
+      if( error == nullptr && tm_platform_next_token( context ) != nullptr ) { error = "unexpected command option"; }
+      if( error != nullptr ) { CommandHost[0] = 0; }
+      return error;
+    }
+
+    if( strcmp( key, "command_queue_size" ) == 0 )
+    {
+      return ParseUnsigned( value, CommandQueueSize, 2, 65536 ) ? nullptr : "invalid setting";
+    }
+
+    if( strcmp( key, "output_extrapolation" ) == 0 )
+    {
+      double milliseconds = 0;
+      if( !ParseDouble( value, milliseconds ) || milliseconds < 0 ) { return "invalid setting"; }
+      OutputExtrapolation = milliseconds * 0.001;
+      return nullptr;
+    }
+
+    return "unknown setting";
+  }
+};
+
+#endif  // TM_TELEMETRY_CONFIG_H
@@ -0,0 +1,417 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_telemetry_sender.h - sends telemetry frames from a dedicated thread
+//
+// The simulation thread only pushes a frame into the ring, encoding and sending happen on the
+// sender thread. Start() is called from Aerofly_FS_2_External_DLL_Init, Stop() joins the thread
+// in Aerofly_FS_2_External_DLL_Shutdown.
+//
+// Every destination has a format, a channel subset and a maximum rate. Destinations with the same
+// format and subset share one encoded datagram, all datagrams of a frame go out in one batch.
+// Destinations with delta frames have an encoding of their own, it holds what they were sent.
+//
+// With a shared memory name every frame is also published there first, before the datagrams go
+// out, see tm_telemetry_shm.h.
+//
+// Without an output rate every frame is sent when it arrives. With one, the thread runs on its own
+// clock and sends the frames of tm_output_scheduler.h instead, sampled between the frames pushed.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_TELEMETRY_SENDER_H
+#define TM_TELEMETRY_SENDER_H
+
+#include "../shared/telemetry/tm_telemetry_frame.h"
+#include "../shared/telemetry/tm_telemetry_shm.h"
+#include "tm_output_scheduler.h"
+#include "tm_platform.h"
+#include "tm_spsc_queue.h"
+#include "tm_stage_stats.h"
+#include "tm_telemetry_config.h"
+#include "tm_udp_sender.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdio.h>
+
+
+static_assert( tm_telemetry_max_destinations <= tm_udp_max_destinations, "more destinations than the fanout supports" );
+
+struct tm_telemetry_destination_stats
+{
+  tm_uint64 Sent    = 0;
+  tm_uint64 Dropped = 0;    // skipped because of the rate limit or a full socket buffer
+  tm_uint64 Errors  = 0;
+  tm_uint64 Bytes   = 0;    // of the datagrams sent
+};
+
+
+class tm_telemetry_sender
+{
+private:
+  struct tm_encoding
+  {
+    tm_telemetry_format        Format;
+    tm_uint64                  ChannelMask[tm_telemetry_channel_mask_words];
+    tm_uint32                  Keyframe;      // 0 without delta frames
+    tm_telemetry_delta_encoder Delta;
+    tm_uint32                  Size;
+    tm_uint8                   Datagram[tm_telemetry_max_datagram_size];
+  };
+
+  struct tm_destination
+  {
+    char                   Name[160];
+    tm_uint32              FanoutIndex;
+    tm_uint32              Encoding;      // index into Encodings
+    tm_uint64              IntervalNs;    // 0 sends every frame
+    tm_uint64              NextSendNs;
+    std::atomic<tm_uint64> Sent{ 0 };
+    std::atomic<tm_uint64> Dropped{ 0 };
+    std::atomic<tm_uint64> Errors{ 0 };
+    std::atomic<tm_uint64> Bytes{ 0 };
+  };
+
+  // frames are stamped when they are pushed, the scheduler maps the clock onto them
+  struct tm_queued_frame
+  {
+    tm_uint64          TimeNs;
+    tm_telemetry_frame Frame;
+  };
+
+  tm_spsc_queue<tm_queued_frame>    Queue;
+  tm_udp_fanout                     Fanout;
+  tm_telemetry_shm_writer           SharedMemory;
+  std::thread                       Thread;
+  std::atomic<bool>                 Running{ false };
+  tm_queue_full_policy              FullPolicy = tm_queue_full_policy::DropOldest;
+
+  tm_output_scheduler               Scheduler;
+  tm_uint64                         OutputIntervalNs = 0;     // 0 sends every frame pushed
+
+  tm_destination                    Destinations[tm_telemetry_max_destinations];
+  tm_uint32                         NumDestinations = 0;
+  tm_encoding                       Encodings[tm_telemetry_max_destinations];
+  tm_uint32                         NumEncodings = 0;
+  double                            DeltaEpsilons[tm_telemetry_max_channels] = {};
+  std::atomic<bool>                 KeyframeRequested{ false };
+  tm_stage_stats                   *StageStats = nullptr;    // queue and send times, nullptr without probes
+
+  static tm_uint64 GetTimeNs()
+  {
+    return static_cast<tm_uint64>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+  }
+
+  // destinations with the same format and channel subset share an encoding, unless they get delta frames
+  tm_uint32 FindEncoding( const tm_telemetry_format format, const tm_uint64 *channel_mask, const tm_uint32 keyframe )
+  {
+    for( tm_uint32 i = 0; i < NumEncodings && keyframe == 0; ++i )
+    {
+      if( Encodings[i].Format == format && Encodings[i].Keyframe == 0 && memcmp( Encodings[i].ChannelMask, channel_mask, sizeof( Encodings[i].ChannelMask ) ) == 0 ) { return i; }
+    }
+
+    tm_encoding &encoding = Encodings[NumEncodings];
+    encoding.Format   = format;
+    encoding.Keyframe = keyframe;
+    memcpy( encoding.ChannelMask, channel_mask, sizeof( encoding.ChannelMask ) );
+    if( keyframe > 0 ) { encoding.Delta.Configure( keyframe, channel_mask, DeltaEpsilons, tm_telemetry_max_channels ); }
+    return NumEncodings++;
+  }
+
+  static tm_uint32 Encode( const tm_telemetry_frame &frame, tm_encoding &encoding )
+  {
+    if( encoding.Keyframe > 0 )
+    {
+      return encoding.Delta.Encode( frame, encoding.Datagram, sizeof( encoding.Datagram ), encoding.Format == tm_telemetry_format::BinaryFloat );
+    }
+
+    const tm_telemetry_frame *source = &frame;
+
+    // only copy the frame if the subset removes channels
+    tm_telemetry_frame subset;
+    bool               restricted = false;
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w ) { restricted |= ( frame.ChannelMask[w] & ~encoding.ChannelMask[w] ) != 0; }
+    if( restricted )
+    {
+      subset = frame;
+      for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w ) { subset.ChannelMask[w] &= encoding.ChannelMask[w]; }
+      source = &subset;
+    }
+
+    switch( encoding.Format )
+    {
+      case tm_telemetry_format::CSV:         return source->EncodeCSV( reinterpret_cast<char*>( encoding.Datagram ), sizeof( encoding.Datagram ) );
+      case tm_telemetry_format::Binary:      return source->EncodeBinary( encoding.Datagram, sizeof( encoding.Datagram ), false );
+      case tm_telemetry_format::BinaryFloat: return source->EncodeBinary( encoding.Datagram, sizeof( encoding.Datagram ), true );
+    }
+
+    return 0;
+  }
+
+  void Send( const tm_telemetry_frame &frame )
+  {
+    tm_udp_datagram    datagrams[tm_telemetry_max_destinations];
+    tm_udp_send_result results[tm_telemetry_max_destinations];
+    tm_uint32          senders[tm_telemetry_max_destinations];
+    bool               encoded[tm_telemetry_max_destinations] = {};
+    tm_uint32          num_datagrams = 0;
+
+    // consumers on the same machine first, it costs no system call
+    if( SharedMemory.IsOpen() ) { SharedMemory.Publish( frame ); }
+
+    const tm_uint64 now = GetTimeNs();
+
+    if( KeyframeRequested.exchange( false, std::memory_order_acquire ) )
+    {
+      for( tm_uint32 i = 0; i < NumEncodings; ++i ) { Encodings[i].Delta.RequestKeyframe(); }
+    }
+
+    // a rate limit does not swallow the only frame that tells about a stall
+    const bool stall = ( frame.Flags & static_cast<tm_uint16>( tm_telemetry_frame_flag::Stall ) ) != 0;
+
+    for( tm_uint32 i = 0; i < NumDestinations; ++i )
+    {
+      tm_destination &destination = Destinations[i];
+
+      if( destination.IntervalNs > 0 )
+      {
+        if( now < destination.NextSendNs && !stall ) { destination.Dropped.fetch_add( 1, std::memory_order_relaxed ); continue; }
+
+        // keep the phase, after a pause start a new one instead of catching up
+        destination.NextSendNs = destination.NextSendNs + destination.IntervalNs > now ? destination.NextSendNs + destination.IntervalNs : now + destination.IntervalNs;
+      }
+
+      tm_encoding &encoding = Encodings[destination.Encoding];
+      if( !encoded[destination.Encoding] )
+      {
+        encoding.Size                 = Encode( frame, encoding );
+        encoded[destination.Encoding] = true;
+      }
+
+      if( encoding.Size == 0 ) { destination.Errors.fetch_add( 1, std::memory_order_relaxed ); continue; }
+
+      datagrams[num_datagrams] = { encoding.Datagram, encoding.Size, destination.FanoutIndex };
+      senders[num_datagrams++] = i;
+    }
+
+    if( num_datagrams == 0 ) { return; }
+
+    Fanout.Send( datagrams, num_datagrams, results );
+
+    for( tm_uint32 k = 0; k < num_datagrams; ++k )
+    {
+      tm_destination &destination = Destinations[senders[k]];
+      switch( results[k] )
+      {
+        case tm_udp_send_result::Sent:
+          destination.Sent.fetch_add( 1, std::memory_order_relaxed );
+          destination.Bytes.fetch_add( datagrams[k].Size, std::memory_order_relaxed );
+          break;
+        case tm_udp_send_result::WouldBlock: destination.Dropped.fetch_add( 1, std::memory_order_relaxed ); break;
+        case tm_udp_send_result::Error:      destination.Errors.fetch_add( 1, std::memory_order_relaxed ); break;
+      }
+    }
+  }
+
+  void Run()
+  {
+    tm_queued_frame queued;
+
+    for( ;; )
+    {
+      const tm_uint32 signal = Queue.GetSignal();
+
+      while( Queue.Pop( queued ) )
+      {
+        if( StageStats == nullptr ) { Send( queued.Frame ); continue; }
+
+        const tm_uint64 start = StageStats->Begin();
+        StageStats->Record( tm_stage::Queue, start - queued.TimeNs );
+        Send( queued.Frame );
+        StageStats->Lap( tm_stage::Send, start );
+      }
+
+      if( !Running.load( std::memory_order_acquire ) ) { break; }
+
+      Queue.WaitForData( signal );
+    }
+  }
+
+  // the same on a fixed clock, the pushed frames only feed the scheduler
+  void RunScheduled()
+  {
+    tm_queued_frame    queued;
+    tm_telemetry_frame frame;
+    tm_uint32          sequence = 0;
+    tm_uint64          tick     = tm_output_get_time_ns();
+
+    for( ;; )
+    {
+      while( Queue.Pop( queued ) ) { Scheduler.Push( queued.Frame, queued.TimeNs ); }
+
+      if( !Running.load( std::memory_order_acquire ) ) { break; }
+
+      const tm_uint64 now = tm_output_get_time_ns();
+      if( now >= tick )
+      {
+        if( Scheduler.Sample( tick, now, frame ) )
+        {
+          const tm_uint64 start = StageStats != nullptr ? StageStats->Begin() : 0;
+          frame.Sequence = sequence++;
+          Send( frame );
+          if( StageStats != nullptr ) { StageStats->Lap( tm_stage::Send, start ); }
+        }
+
+        // skip the ticks that passed meanwhile instead of sending a burst
+        tick += OutputIntervalNs;
+        if( tick <= now )
+        {
+          const tm_uint64 missed = ( now - tick ) / OutputIntervalNs + 1;
+          Scheduler.AddMissedTicks( missed );
+          tick += missed * OutputIntervalNs;
+        }
+      }
+
+      tm_output_sleep_until( tick );
+    }
+  }
+
+  bool AddDestination( const tm_telemetry_destination &config, const tm_telemetry_format default_format )
+  {
+    const int fanout_index = Fanout.AddDestination( config.Host, config.Service );
+    if( fanout_index < 0 )
+    {
+      tm_platform_log( "cannot send to %s:%s", config.Host, config.Service );
+      return false;
+    }
+
+    tm_destination &destination = Destinations[NumDestinations++];
+    snprintf( destination.Name, sizeof( destination.Name ), strchr( config.Host, ':' ) != nullptr ? "[%s]:%s" : "%s:%s", config.Host, config.Service );
+    destination.FanoutIndex = static_cast<tm_uint32>( fanout_index );
+    const tm_telemetry_format format = config.DefaultFormat ? default_format : config.Format;
+    if( config.Keyframe > 0 && format == tm_telemetry_format::CSV ) { tm_platform_log( "%s: delta frames need a binary format", destination.Name ); }
+
+    destination.Encoding    = FindEncoding( format, config.ChannelMask, format != tm_telemetry_format::CSV ? config.Keyframe : 0 );
+    destination.IntervalNs  = config.MaxRate > 0 ? static_cast<tm_uint64>( 1e9 / config.MaxRate ) : 0;
+    destination.NextSendNs  = 0;
+    destination.Sent.store( 0, std::memory_order_relaxed );
+    destination.Dropped.store( 0, std::memory_order_relaxed );
+    destination.Errors.store( 0, std::memory_order_relaxed );
+    destination.Bytes.store( 0, std::memory_order_relaxed );
+    return true;
+  }
+
+public:
+  tm_telemetry_sender() = default;
+  tm_telemetry_sender( const tm_telemetry_sender & ) = delete;
+  tm_telemetry_sender &operator=( const tm_telemetry_sender & ) = delete;
+  ~tm_telemetry_sender() { Stop(); }
+
+  //
+  // 'output_channels' describe the values for the scheduler and 'delta_epsilons' the smallest
+  // change of them delta frames send, one per value. both are optional, as are the probes of
+  // 'stage_stats'.
+  //
+  bool Start( const tm_telemetry_config &config, const tm_output_channel *output_channels = nullptr, const double *delta_epsilons = nullptr, const tm_uint32 num_values = 0,
+              tm_stage_stats *stage_stats = nullptr )
+  {
+    Stop();
+
+    StageStats = stage_stats != nullptr && stage_stats->IsEnabled() ? stage_stats : nullptr;
+
+    for( tm_uint32 i = 0; i < tm_telemetry_max_channels; ++i ) { DeltaEpsilons[i] = delta_epsilons != nullptr && i < num_values ? delta_epsilons[i] : 0; }
+    KeyframeRequested.store( false, std::memory_order_relaxed );
+
+    OutputIntervalNs = config.OutputRate > 0 ? static_cast<tm_uint64>( 1e9 / config.OutputRate ) : 0;
+    Scheduler.Configure( output_channels, output_channels != nullptr ? num_values : 0, config.OutputDelay, config.OutputExtrapolation );
+
+    FullPolicy = config.QueueFullPolicy;
+    Queue.Reset( config.QueueSize );
+
+    if( !Fanout.Open( config.MulticastTTL ) ) { return false; }
+
+    if( config.SharedMemoryName[0] != 0 )
+    {
+      if( SharedMemory.Open( config.SharedMemoryName, config.SharedMemorySlots ) ) { tm_platform_log( "publishing to shared memory '%s'", config.SharedMemoryName ); }
+      else                                                                        { tm_platform_log( "cannot create shared memory '%s'", config.SharedMemoryName ); }
+    }
+
+    // 127.0.0.1:4123, the local plugin port, unless destinations or shared memory are configured
+    NumDestinations = 0;
+    NumEncodings    = 0;
+    if( config.NumDestinations == 0 && !SharedMemory.IsOpen() )
+    {
+      AddDestination( tm_telemetry_destination(), config.Format );
+    }
+
+    for( tm_uint32 i = 0; i < config.NumDestinations; ++i )
+    {
+      AddDestination( config.Destinations[i], config.Format );
+    }
+
+    if( NumDestinations == 0 && !SharedMemory.IsOpen() )
+    {
+      Fanout.Close();
+      return false;
+    }
+
+    Running.store( true, std::memory_order_release );
+    Thread = std::thread( OutputIntervalNs > 0 ? &tm_telemetry_sender::RunScheduled : &tm_telemetry_sender::Run, this );
+    return true;
+  }
+
+  void Stop()
+  {
+    if( Thread.joinable() )
+    {
+      Running.store( false, std::memory_order_release );
+      Queue.Wake();
+      Thread.join();
+    }
+
+    Fanout.Close();
+    SharedMemory.Close();
+  }
+
+  bool IsRunning() const { return Running.load( std::memory_order_relaxed ); }
+
+  // the next frame of every destination with delta frames is a keyframe, from any thread
+  void RequestKeyframe() { KeyframeRequested.store( true, std::memory_order_release ); }
+
+  // called on the simulation thread, never blocks
+  bool Push( const tm_telemetry_frame &frame )
+  {
+    return Queue.Push( { OutputIntervalNs > 0 || StageStats != nullptr ? tm_output_get_time_ns() : 0, frame }, FullPolicy );
+  }
+
+  // frames published to shared memory, read after Stop()
+  tm_uint64 GetSharedMemoryPublished() const { return SharedMemory.GetPublished(); }
+
+  // frames dropped between the simulation and the sender thread
+  tm_uint64 GetDropped() const { return Queue.GetDropped(); }
+
+  // the fixed rate output, read after Stop()
+  bool                   IsScheduled()    const { return OutputIntervalNs > 0; }
+  double                 GetOutputRate()  const { return OutputIntervalNs > 0 ? 1e9 / OutputIntervalNs : 0; }
+  double                 GetOutputDelay() const { return Scheduler.GetDelay(); }
+  const tm_output_stats &GetOutputStats() const { return Scheduler.GetStats(); }
+
+  //
+  // per destination counters, safe to read from any thread
+  //
+  tm_uint32   GetNumDestinations()                     const { return NumDestinations; }
+  const char *GetDestinationName( const tm_uint32 i )  const { return Destinations[i].Name; }
+
+  tm_telemetry_destination_stats GetDestinationStats( const tm_uint32 i ) const
+  {
+    tm_telemetry_destination_stats stats;
+    stats.Sent    = Destinations[i].Sent.load( std::memory_order_relaxed );
+    stats.Dropped = Destinations[i].Dropped.load( std::memory_order_relaxed );
+    stats.Errors  = Destinations[i].Errors.load( std::memory_order_relaxed );
+    stats.Bytes   = Destinations[i].Bytes.load( std::memory_order_relaxed );
+    return stats;
+  }
+};
+
+#endif  // TM_TELEMETRY_SENDER_H
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_triple_buffer.h - the latest value of one writer for one reader on another thread
+//
+// Three copies of the value: the writer fills the back one, the reader reads the front one and
+// the middle one holds the latest publication. Publish() swaps back and middle, Update() swaps
+// middle and front when something new was published since. Each side owns its copy until it
+// swaps, a swap is one atomic exchange, so neither side ever waits for the other and the reader
+// never sees a value that is half written. Values published while the reader did not look are
+// skipped, the reader always gets the latest one.
+//
+// There is one reader per buffer. Threads that read the same value each get a buffer of their
+// own. The reader calls Attach() before it starts reading and Detach() when it is done, a writer
+// that publishes a large value every frame checks HasReader() first and skips the copy when
+// nobody is reading.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_TRIPLE_BUFFER_H
+#define TM_TRIPLE_BUFFER_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <atomic>
+
+
+template<typename T> class tm_triple_buffer
+{
+private:
+  static constexpr tm_uint8 Fresh = 4;     // set in Middle when the reader did not take it yet
+
+  struct alignas( 64 ) tm_copy
+  {
+    T Value;
+  };
+
+  tm_copy                              Copies[3];
+  alignas( 64 ) std::atomic<tm_uint8>  Middle{ 1 };
+  std::atomic<bool>                    Attached{ false };
+  alignas( 64 ) tm_uint8               Back  = 0;       // writer only
+  std::atomic<tm_uint64>               Published{ 0 };
+  alignas( 64 ) tm_uint8               Front = 2;       // reader only
+
+public:
+  constexpr tm_triple_buffer() = default;
+  tm_triple_buffer( const tm_triple_buffer & ) = delete;
+  tm_triple_buffer &operator=( const tm_triple_buffer & ) = delete;
+
+  //
+  // writer side. GetBack() is the copy to fill in place, Publish() makes it the latest one. the
+  // new back copy is an older value, not the one just published.
+  //
+  T &GetBack() { return Copies[Back].Value; }
+
+  void Publish()
+  {
+    Back = Middle.exchange( Back | Fresh, std::memory_order_acq_rel ) & ~Fresh;
+    Published.store( Published.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+  }
+
+  void Publish( const T &value )
+  {
+    Copies[Back].Value = value;
+    Publish();
+  }
+
+  tm_uint64 GetPublished() const { return Published.load( std::memory_order_relaxed ); }
+
+  // true between Attach() and Detach() of the reader
+  bool HasReader() const { return Attached.load( std::memory_order_relaxed ); }
+
+  //
+  // reader side. Update() takes the latest publication and returns false when there was none
+  // since the last call, Read() stays valid until the next Update(). after Attach() the first
+  // publication may take a frame, until then Read() returns a default constructed value.
+  //
+  void Attach() { Attached.store( true, std::memory_order_relaxed ); }
+  void Detach() { Attached.store( false, std::memory_order_relaxed ); }
+
+  bool Update()
+  {
+    if( ( Middle.load( std::memory_order_relaxed ) & Fresh ) == 0 ) { return false; }
+
+    Front = Middle.exchange( Front, std::memory_order_acq_rel ) & ~Fresh;
+    return true;
+  }
+
+  const T &Read() const { return Copies[Front].Value; }
+};
+
+#endif  // TM_TRIPLE_BUFFER_H
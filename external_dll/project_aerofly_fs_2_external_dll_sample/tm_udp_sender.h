@@ -0,0 +1,360 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_udp_sender.h - persistent udp senders
+//
+// The sockets are created and the destinations are resolved once, every frame only sends.
+// tm_udp_sender has one destination, tm_udp_fanout sends a batch of datagrams to several
+// destinations with one sendmmsg call per socket on Linux and a loop of sendto elsewhere.
+// Winsock and BSD sockets are hidden behind the few helpers below.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_UDP_SENDER_H
+#define TM_UDP_SENDER_H
+
+#include "tm_platform.h"
+#include "../shared/input/tm_external_message.h"
+
+#if TM_PLATFORM_WINDOWS
+  #pragma comment(lib, "ws2_32.lib")
+#else
+  #include <sys/types.h>
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <arpa/inet.h>
+  #include <netdb.h>
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// platform layer
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+#if TM_PLATFORM_WINDOWS
+  using tm_socket = SOCKET;
+  static const tm_socket tm_socket_invalid = INVALID_SOCKET;
+
+  inline bool tm_socket_startup()                 { WSADATA wsa_data; return WSAStartup( MAKEWORD( 2, 2 ), &wsa_data ) == 0; }
+  inline void tm_socket_cleanup()                 { WSACleanup(); }
+  inline void tm_socket_close( tm_socket s )      { closesocket( s ); }
+  inline bool tm_socket_set_nonblocking( tm_socket s )
+  {
+    u_long mode = 1;
+    return ioctlsocket( s, FIONBIO, &mode ) == 0;
+  }
+  inline bool tm_socket_would_block()             { return WSAGetLastError() == WSAEWOULDBLOCK; }
+#else
+  using tm_socket = int;
+  static const tm_socket tm_socket_invalid = -1;
+
+  inline bool tm_socket_startup()                 { return true; }
+  inline void tm_socket_cleanup()                 { }
+  inline void tm_socket_close( tm_socket s )      { close( s ); }
+  inline bool tm_socket_set_nonblocking( tm_socket s )
+  {
+    const int flags = fcntl( s, F_GETFL, 0 );
+    return flags != -1 && fcntl( s, F_SETFL, flags | O_NONBLOCK ) == 0;
+  }
+  inline bool tm_socket_would_block()             { return errno == EAGAIN || errno == EWOULDBLOCK; }
+#endif
+
+inline bool tm_socket_resolve( const char *hostname, const char *service, sockaddr_storage &address, tm_uint32 &address_length )
+{
+  addrinfo *result_list = nullptr;
+  addrinfo  hints       = {};
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = SOCK_DGRAM; // without this flag, getaddrinfo will return 3x the number of addresses (one for each socket type).
+
+  if( getaddrinfo( hostname, service, &hints, &result_list ) != 0 || result_list == nullptr )
+  {
+    return false;
+  }
+
+  memcpy( &address, result_list->ai_addr, result_list->ai_addrlen );
+  address_length = static_cast<tm_uint32>( result_list->ai_addrlen );
+  freeaddrinfo( result_list );
+  return true;
+}
+
+inline bool tm_socket_is_multicast( const sockaddr_storage &address )
+{
+  if( address.ss_family == AF_INET )
+  {
+    const auto &ipv4 = reinterpret_cast<const sockaddr_in&>( address );
+    return ( ntohl( ipv4.sin_addr.s_addr ) & 0xf0000000u ) == 0xe0000000u;
+  }
+
+  if( address.ss_family == AF_INET6 )
+  {
+    const auto &ipv6 = reinterpret_cast<const sockaddr_in6&>( address );
+    return ipv6.sin6_addr.s6_addr[0] == 0xff;
+  }
+
+  return false;
+}
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_udp_sender
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_udp_sender
+{
+private:
+  tm_socket         Socket        = tm_socket_invalid;
+  sockaddr_storage  Address       = {};
+  tm_uint32         AddressLength = 0;
+  bool              Started       = false;
+
+public:
+  tm_udp_sender() = default;
+  tm_udp_sender( const tm_udp_sender & ) = delete;
+  tm_udp_sender &operator=( const tm_udp_sender & ) = delete;
+  ~tm_udp_sender() { Close(); }
+
+  bool IsOpen() const { return Socket != tm_socket_invalid; }
+
+  bool Open( const char *hostname, const char *service )
+  {
+    Close();
+
+    Started = tm_socket_startup();
+    if( !Started ) { return false; }
+
+    if( !tm_socket_resolve( hostname, service, Address, AddressLength ) )
+    {
+      Close();
+      return false;
+    }
+
+    Socket = socket( Address.ss_family, SOCK_DGRAM, 0 );
+    if( Socket == tm_socket_invalid )
+    {
+      Close();
+      return false;
+    }
+
+    // never let a full socket buffer stall the simulation, a dropped datagram is the better choice
+    tm_socket_set_nonblocking( Socket );
+    return true;
+  }
+
+  void Close()
+  {
+    if( Socket != tm_socket_invalid )
+    {
+      tm_socket_close( Socket );
+      Socket = tm_socket_invalid;
+    }
+
+    if( Started )
+    {
+      tm_socket_cleanup();
+      Started = false;
+    }
+  }
+
+  bool Send( const void *data, const tm_uint32 size ) const
+  {
+    if( Socket == tm_socket_invalid ) { return false; }
+
+    const auto result = sendto( Socket, static_cast<const char*>( data ), static_cast<int>( size ), 0, reinterpret_cast<const sockaddr*>( &Address ), AddressLength );
+    return result == static_cast<int>( size );
+  }
+};
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_udp_fanout
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr tm_uint32 tm_udp_max_destinations = 16;
+
+enum class tm_udp_send_result : tm_uint8
+{
+  Sent,
+  WouldBlock,     // the socket buffer is full, the datagram is dropped
+  Error
+};
+
+struct tm_udp_datagram
+{
+  const void *Data;
+  tm_uint32   Size;
+  tm_uint32   Destination;    // index returned by tm_udp_fanout::AddDestination
+};
+
+class tm_udp_fanout
+{
+private:
+  struct tm_udp_destination
+  {
+    sockaddr_storage Address;
+    tm_uint32        AddressLength;
+    tm_uint32        Family;          // index into Sockets
+  };
+
+  tm_socket          Sockets[2]      = { tm_socket_invalid, tm_socket_invalid };    // ipv4, ipv6
+  tm_udp_destination Destinations[tm_udp_max_destinations];
+  tm_uint32          NumDestinations = 0;
+  tm_uint32          MulticastTTL    = 1;
+  bool               Started         = false;
+
+  // one socket per address family, created for the first destination that needs it
+  bool OpenSocket( const tm_uint32 family, const bool multicast )
+  {
+    tm_socket &s = Sockets[family];
+    if( s == tm_socket_invalid )
+    {
+      s = socket( family == 0 ? AF_INET : AF_INET6, SOCK_DGRAM, 0 );
+      if( s == tm_socket_invalid ) { return false; }
+
+      // never let a full socket buffer stall the sender, a dropped datagram is the better choice
+      tm_socket_set_nonblocking( s );
+    }
+
+    // loop back so consumers on the same machine receive the group too
+    if( multicast )
+    {
+      const int ttl  = static_cast<int>( MulticastTTL );
+      const int loop = 1;
+      if( family == 0 )
+      {
+        setsockopt( s, IPPROTO_IP, IP_MULTICAST_TTL,  reinterpret_cast<const char*>( &ttl ),  sizeof( ttl ) );
+        setsockopt( s, IPPROTO_IP, IP_MULTICAST_LOOP, reinterpret_cast<const char*>( &loop ), sizeof( loop ) );
+      }
+      else
+      {
+        setsockopt( s, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, reinterpret_cast<const char*>( &ttl ),  sizeof( ttl ) );
+        setsockopt( s, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, reinterpret_cast<const char*>( &loop ), sizeof( loop ) );
+      }
+    }
+
+    return true;
+  }
+
+  static tm_udp_send_result GetSendResult( const long long result, const tm_uint32 size )
+  {
+    if( result == static_cast<long long>( size ) ) { return tm_udp_send_result::Sent; }
+    return result < 0 && tm_socket_would_block() ? tm_udp_send_result::WouldBlock : tm_udp_send_result::Error;
+  }
+
+public:
+  tm_udp_fanout() = default;
+  tm_udp_fanout( const tm_udp_fanout & ) = delete;
+  tm_udp_fanout &operator=( const tm_udp_fanout & ) = delete;
+  ~tm_udp_fanout() { Close(); }
+
+  bool Open( const tm_uint32 multicast_ttl )
+  {
+    Close();
+    MulticastTTL = multicast_ttl;
+    Started      = tm_socket_startup();
+    return Started;
+  }
+
+  void Close()
+  {
+    for( auto &s : Sockets )
+    {
+      if( s != tm_socket_invalid ) { tm_socket_close( s ); }
+      s = tm_socket_invalid;
+    }
+
+    NumDestinations = 0;
+
+    if( Started )
+    {
+      tm_socket_cleanup();
+      Started = false;
+    }
+  }
+
+  tm_uint32 GetNumDestinations() const { return NumDestinations; }
+
+  bool IsMulticast( const tm_uint32 destination ) const { return tm_socket_is_multicast( Destinations[destination].Address ); }
+
+  //
+  // resolves the destination, returns its index or -1
+  //
+  int AddDestination( const char *hostname, const char *service )
+  {
+    if( !Started || NumDestinations == tm_udp_max_destinations ) { return -1; }
+
+    tm_udp_destination &destination = Destinations[NumDestinations];
+    if( !tm_socket_resolve( hostname, service, destination.Address, destination.AddressLength ) ) { return -1; }
+    if( destination.Address.ss_family != AF_INET && destination.Address.ss_family != AF_INET6 ) { return -1; }
+
+    destination.Family = destination.Address.ss_family == AF_INET6 ? 1 : 0;
+    if( !OpenSocket( destination.Family, tm_socket_is_multicast( destination.Address ) ) ) { return -1; }
+
+    return static_cast<int>( NumDestinations++ );
+  }
+
+  //
+  // sends all datagrams and stores the outcome of each one in results
+  //
+  void Send( const tm_udp_datagram *datagrams, const tm_uint32 num_datagrams, tm_udp_send_result *results ) const
+  {
+#if defined(__linux__)
+    mmsghdr   messages[tm_udp_max_destinations];
+    iovec     buffers[tm_udp_max_destinations];
+    tm_uint32 indices[tm_udp_max_destinations];
+
+    for( tm_uint32 family = 0; family < 2; ++family )
+    {
+      tm_uint32 n = 0;
+      for( tm_uint32 i = 0; i < num_datagrams && n < tm_udp_max_destinations; ++i )
+      {
+        const tm_udp_destination &destination = Destinations[datagrams[i].Destination];
+        if( destination.Family != family ) { continue; }
+
+        buffers[n]  = { const_cast<void*>( datagrams[i].Data ), datagrams[i].Size };
+        messages[n] = {};
+        messages[n].msg_hdr.msg_name    = const_cast<sockaddr_storage*>( &destination.Address );
+        messages[n].msg_hdr.msg_namelen = destination.AddressLength;
+        messages[n].msg_hdr.msg_iov     = &buffers[n];
+        messages[n].msg_hdr.msg_iovlen  = 1;
+        indices[n++] = i;
+      }
+
+      // sendmmsg stops at the first datagram that fails, record it and go on with the rest
+      for( tm_uint32 done = 0; done < n; )
+      {
+        const int result = sendmmsg( Sockets[family], messages + done, n - done, 0 );
+        if( result > 0 )
+        {
+          for( int k = 0; k < result; ++k, ++done ) { results[indices[done]] = GetSendResult( messages[done].msg_len, datagrams[indices[done]].Size ); }
+        }
+        else
+        {
+          results[indices[done++]] = GetSendResult( -1, 0 );
+        }
+      }
+    }
+#else
+    for( tm_uint32 i = 0; i < num_datagrams; ++i )
+    {
+      const tm_udp_destination &destination = Destinations[datagrams[i].Destination];
+      const auto result = sendto( Sockets[destination.Family], static_cast<const char*>( datagrams[i].Data ), static_cast<int>( datagrams[i].Size ), 0,
+                                  reinterpret_cast<const sockaddr*>( &destination.Address ), destination.AddressLength );
+      results[i] = GetSendResult( result, datagrams[i].Size );
+    }
+#endif
+  }
+};
+
+#endif  // TM_UDP_SENDER_H
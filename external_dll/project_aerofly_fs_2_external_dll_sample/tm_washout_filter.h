@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// file tm_washout_filter.h - motion cueing washout filter that runs in Update
+//
+// The classical washout of a motion platform, computed at the rate of the simulation with the
+// real delta_time instead of downstream at a fixed consumer rate. Six cues are produced:
+//
+//      channel  value                                               unit
+//            0  Surge      high-passed specific force, body x       m/s^2
+//            1  Sway       high-passed specific force, body y       m/s^2
+//            2  Heave      high-passed specific force, body z       m/s^2
+//            3  TiltPitch  asin( low-passed specific force x / g )  rad
+//            4  TiltRoll   asin( low-passed specific force y / g )  rad
+//            5  Yaw        high-passed angular velocity, body z     rad/s
+//
+// The onset of an acceleration goes to surge/sway/heave and fades out, the sustained part is
+// turned into a tilt of the platform so that gravity pushes the pilot in the same direction
+// (tilt coordination). The tilt angles are rate limited to stay below what is noticed as rotation.
+//
+// Every channel is a second order filter in state variable form, discretized with the
+// trapezoidal rule. High- and low-pass differ only in how the state is mixed into the output, so
+// all channels share one code path over structure-of-arrays state and the six channels are
+// updated in one loop the compiler vectorizes. The coefficients depend on delta_time and are only
+// recomputed when it changes.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_WASHOUT_FILTER_H
+#define TM_WASHOUT_FILTER_H
+
+#include "../shared/input/tm_external_message.h"
+
+#include <math.h>
+
+
+enum class tm_washout_channel : tm_uint32
+{
+  Surge,
+  Sway,
+  Heave,
+  TiltPitch,
+  TiltRoll,
+  Yaw,
+  Count
+};
+
+constexpr tm_uint32 tm_washout_num_channels = static_cast<tm_uint32>( tm_washout_channel::Count );
+
+struct tm_washout_settings
+{
+  bool   Enabled         = false;
+  double SurgeCutoff     = 0.3;     // high-pass corner frequencies in Hz
+  double SwayCutoff      = 0.3;
+  double HeaveCutoff     = 0.5;
+  double YawCutoff       = 0.2;
+  double TiltCutoff      = 0.2;     // low-pass corner frequency of the tilt coordination in Hz
+  double TiltRateLimit   = 3.0;     // degrees per second, 0 does not limit
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_washout_filter
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_washout_filter
+{
+private:
+  // padded to a multiple of four doubles so the loops need no remainder
+  static constexpr tm_uint32 Lanes   = 8;
+  static constexpr double    Damping = 1.4142135623730951;     // 1 / Q, Butterworth
+  static constexpr double    Gravity = 9.80665;
+  static constexpr double    Pi      = 3.14159265358979323846;
+
+  static_assert( tm_washout_num_channels <= Lanes, "too many washout channels" );
+
+  alignas( 64 ) double Cutoff[Lanes]   = {};    // Hz, 0 for unused lanes
+  alignas( 64 ) double HighMix[Lanes]  = {};    // 1 for high-pass lanes
+  alignas( 64 ) double LowMix[Lanes]   = {};    // 1 for low-pass lanes
+  alignas( 64 ) double A1[Lanes]       = {};
+  alignas( 64 ) double A2[Lanes]       = {};
+  alignas( 64 ) double A3[Lanes]       = {};
+  alignas( 64 ) double State1[Lanes]   = {};
+  alignas( 64 ) double State2[Lanes]   = {};
+  alignas( 64 ) double Input[Lanes]    = {};
+  alignas( 64 ) double Output[Lanes]   = {};
+
+  double    DeltaTime     = 0;              // the coefficients were computed for
+  double    TiltRateLimit = 0;              // rad/s
+  double    Tilt[2]       = {};             // rate limited tilt angles, pitch and roll
+  bool      Primed        = false;
+
+  void UpdateCoefficients( const double delta_time )
+  {
+    DeltaTime = delta_time;
+
+    for( tm_uint32 i = 0; i < Lanes; ++i )
+    {
+      // keep the corner below the nyquist frequency, tan() grows without bound there
+      double wd = Pi * Cutoff[i] * delta_time;
+      wd = wd < 1.5 ? wd : 1.5;
+
+      const double g = tan( wd );
+      A1[i] = 1.0 / ( 1.0 + g * ( g + Damping ) );
+      A2[i] = g * A1[i];
+      A3[i] = g * A2[i];
+    }
+  }
+
+  // low-pass lanes start settled at their input, high-pass lanes at 0
+  void Prime()
+  {
+    for( tm_uint32 i = 0; i < Lanes; ++i )
+    {
+      State1[i] = 0;
+      State2[i] = Input[i];
+    }
+
+    Tilt[0] = TiltAngle( Input[static_cast<tm_uint32>( tm_washout_channel::TiltPitch )] );
+    Tilt[1] = TiltAngle( Input[static_cast<tm_uint32>( tm_washout_channel::TiltRoll )] );
+    Primed  = true;
+  }
+
+  static double TiltAngle( const double specific_force )
+  {
+    const double s = specific_force / Gravity;
+    return asin( s < -1.0 ? -1.0 : s > 1.0 ? 1.0 : s );
+  }
+
+  static double Approach( const double current, const double target, const double max_step )
+  {
+    if( max_step <= 0 )               { return target; }
+    if( target > current + max_step ) { return current + max_step; }
+    if( target < current - max_step ) { return current - max_step; }
+    return target;
+  }
+
+public:
+  // constexpr so a global filter is constant initialized and runs no code when the dll is loaded
+  constexpr tm_washout_filter() { Configure( tm_washout_settings() ); }
+
+  constexpr void Configure( const tm_washout_settings &settings )
+  {
+    for( tm_uint32 i = 0; i < Lanes; ++i ) { Cutoff[i] = HighMix[i] = LowMix[i] = 0; }
+
+    const auto set = [this]( const tm_washout_channel channel, const double cutoff, const bool high_pass )
+    {
+      const tm_uint32 i = static_cast<tm_uint32>( channel );
+      Cutoff[i]  = cutoff > 0 ? cutoff : 0;
+      HighMix[i] = high_pass ? 1.0 : 0.0;
+      LowMix[i]  = high_pass ? 0.0 : 1.0;
+    };
+
+    set( tm_washout_channel::Surge,     settings.SurgeCutoff, true );
+    set( tm_washout_channel::Sway,      settings.SwayCutoff,  true );
+    set( tm_washout_channel::Heave,     settings.HeaveCutoff, true );
+    set( tm_washout_channel::TiltPitch, settings.TiltCutoff,  false );
+    set( tm_washout_channel::TiltRoll,  settings.TiltCutoff,  false );
+    set( tm_washout_channel::Yaw,       settings.YawCutoff,   true );
+
+    TiltRateLimit = settings.TiltRateLimit * Pi / 180.0;
+    Reset();
+  }
+
+  // forgets the filter state, the next Update starts settled at its input
+  constexpr void Reset()
+  {
+    DeltaTime = 0;
+    Primed    = false;
+    for( tm_uint32 i = 0; i < Lanes; ++i ) { Input[i] = Output[i] = State1[i] = State2[i] = 0; }
+    Tilt[0] = Tilt[1] = 0;
+  }
+
+  //
+  // the inputs, in the body frame of the aircraft. they are kept until they are set again, so
+  // messages that are not sent every frame hold their last value.
+  //
+  void SetSpecificForce( const tm_vector3d &specific_force )
+  {
+    Input[static_cast<tm_uint32>( tm_washout_channel::Surge )]     = specific_force.x;
+    Input[static_cast<tm_uint32>( tm_washout_channel::Sway )]      = specific_force.y;
+    Input[static_cast<tm_uint32>( tm_washout_channel::Heave )]     = specific_force.z;
+    Input[static_cast<tm_uint32>( tm_washout_channel::TiltPitch )] = specific_force.x;
+    Input[static_cast<tm_uint32>( tm_washout_channel::TiltRoll )]  = specific_force.y;
+  }
+
+  void SetAngularVelocity( const tm_vector3d &angular_velocity )
+  {
+    Input[static_cast<tm_uint32>( tm_washout_channel::Yaw )] = angular_velocity.z;
+  }
+
+  //
+  // advances all channels by 'delta_time' seconds. a delta_time of 0, e.g. while the simulation
+  // is paused, keeps the outputs.
+  //
+  void Update( const double delta_time )
+  {
+    if( delta_time <= 0 ) { return; }
+    if( !Primed ) { Prime(); }
+    if( delta_time != DeltaTime ) { UpdateCoefficients( delta_time ); }
+
+    for( tm_uint32 i = 0; i < Lanes; ++i )
+    {
+      const double v3 = Input[i] - State2[i];
+      const double v1 = A1[i] * State1[i] + A2[i] * v3;
+      const double v2 = State2[i] + A2[i] * State1[i] + A3[i] * v3;
+      State1[i] = 2.0 * v1 - State1[i];
+      State2[i] = 2.0 * v2 - State2[i];
+
+      const double high = Input[i] - Damping * v1 - v2;
+      Output[i] = HighMix[i] * high + LowMix[i] * v2;
+    }
+
+    const double max_step = TiltRateLimit * delta_time;
+    Tilt[0] = Approach( Tilt[0], TiltAngle( Output[static_cast<tm_uint32>( tm_washout_channel::TiltPitch )] ), max_step );
+    Tilt[1] = Approach( Tilt[1], TiltAngle( Output[static_cast<tm_uint32>( tm_washout_channel::TiltRoll )] ), max_step );
+  }
+
+  double GetOutput( const tm_washout_channel channel ) const
+  {
+    switch( channel )
+    {
+      case tm_washout_channel::TiltPitch: return Tilt[0];
+      case tm_washout_channel::TiltRoll:  return Tilt[1];
+      default:                            return Output[static_cast<tm_uint32>( channel )];
+    }
+  }
+
+  // writes the six cues to values[0..5]
+  void GetOutputs( double *values ) const
+  {
+    for( tm_uint32 i = 0; i < tm_washout_num_channels; ++i ) { values[i] = GetOutput( static_cast<tm_washout_channel>( i ) ); }
+  }
+};
+
+#endif  // TM_WASHOUT_FILTER_H
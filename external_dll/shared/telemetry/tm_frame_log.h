@@ -0,0 +1,215 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// tm_frame_log.h - file format of the raw frame recordings of the telemetry dll
+//
+// A recording holds every byte stream the dll received in Aerofly_FS_2_External_DLL_Update,
+// unchanged, so the exact input of a session can be replayed. All fields are little-endian.
+//
+//  file header, 64 bytes
+//
+//      offset  size  field
+//           0     4  Magic          'AFRL' (0x4c524641)
+//           4     2  Version        tm_frame_log_version
+//           6     2  HeaderSize     64, records start here
+//           8     8  StartTime      wall clock at the start, nanoseconds since 1970-01-01 UTC
+//          16     8  IndexOffset    offset of the index record, 0 if the recording was not closed
+//          24     8  NumFrames      number of frame records
+//          32     8  DataEnd        end of the last complete record
+//          40    24  reserved       0
+//
+//  records, one after another from HeaderSize to DataEnd, each starting at a multiple of 8
+//
+//      offset  size  field
+//           0     4  Type           tm_frame_log_record_type
+//           4     4  Size           number of payload bytes that follow the record header
+//           8     8  Timestamp      monotonic clock when Update was called, nanoseconds since the start
+//          16     8  DeltaTime      delta_time passed to Update (IEEE 754 double)
+//          24     4  NumMessages    message_list_received_num_messages passed to Update
+//          28     4  reserved       0
+//          32  Size  Payload        then zero padding up to the next multiple of 8
+//
+//  Frame records carry message_list_received_byte_stream as payload. The index record is
+//  written when the recording is closed, its payload is one tm_frame_log_index_entry for about
+//  every tm_frame_log_index_interval nanoseconds, which allows to seek by time without reading
+//  the frames in between. DataEnd and NumFrames are updated after every frame, a recording that
+//  was not closed can still be read up to DataEnd by walking the records.
+//
+// tm_frame_log_reader at the end of this file reads recordings with stdio. The header has no
+// dependency other than tm_external_message.h and the standard library so tools can use it as is.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_FRAME_LOG_H
+#define TM_FRAME_LOG_H
+
+#include "../input/tm_external_message.h"
+
+#include <stdio.h>
+#include <vector>
+
+
+constexpr tm_uint32 tm_frame_log_magic          = 0x4c524641;   // 'AFRL' in little-endian byte order
+constexpr tm_uint16 tm_frame_log_version        = 1;
+constexpr tm_uint64 tm_frame_log_index_interval = 1000000000;   // one index entry per second
+
+enum class tm_frame_log_record_type : tm_uint32
+{
+  Frame = 1,
+  Index = 2
+};
+
+struct tm_frame_log_header
+{
+  tm_uint32 Magic       = tm_frame_log_magic;
+  tm_uint16 Version     = tm_frame_log_version;
+  tm_uint16 HeaderSize  = 64;
+  tm_uint64 StartTime   = 0;
+  tm_uint64 IndexOffset = 0;
+  tm_uint64 NumFrames   = 0;
+  tm_uint64 DataEnd     = 64;
+  tm_uint64 Reserved[3] = {};
+};
+
+struct tm_frame_log_record
+{
+  tm_frame_log_record_type Type        = tm_frame_log_record_type::Frame;
+  tm_uint32                Size        = 0;
+  tm_uint64                Timestamp   = 0;
+  tm_double                DeltaTime   = 0;
+  tm_uint32                NumMessages = 0;
+  tm_uint32                Reserved    = 0;
+};
+
+struct tm_frame_log_index_entry
+{
+  tm_uint64 Timestamp;      // of the frame the entry points to
+  tm_uint64 Frame;          // number of frames before it
+  tm_uint64 Offset;         // file offset of its record
+};
+
+static_assert( sizeof( tm_frame_log_header ) == 64, "unexpected size of tm_frame_log_header" );
+static_assert( sizeof( tm_frame_log_record ) == 32, "unexpected size of tm_frame_log_record" );
+static_assert( sizeof( tm_frame_log_index_entry ) == 24, "unexpected size of tm_frame_log_index_entry" );
+
+// size of a record in the file, header and padded payload
+constexpr tm_uint64 tm_frame_log_record_size( const tm_uint32 payload_size )
+{
+  return sizeof( tm_frame_log_record ) + ( ( static_cast<tm_uint64>( payload_size ) + 7 ) & ~tm_uint64( 7 ) );
+}
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_frame_log_reader - reads the frames of a recording one after another
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_frame_log_reader
+{
+private:
+  FILE                                 *File     = nullptr;
+  tm_frame_log_header                   Header;
+  std::vector<tm_frame_log_index_entry> Index;
+  tm_uint64                             Position = 0;
+
+  bool SeekFile( const tm_uint64 offset )
+  {
+#if defined(WIN32) || defined(WIN64)
+    return _fseeki64( File, static_cast<__int64>( offset ), SEEK_SET ) == 0;
+#else
+    return fseeko( File, static_cast<off_t>( offset ), SEEK_SET ) == 0;
+#endif
+  }
+
+  bool Read( const tm_uint64 offset, void *data, const size_t size )
+  {
+    return SeekFile( offset ) && fread( data, 1, size, File ) == size;
+  }
+
+public:
+  tm_frame_log_reader() = default;
+  tm_frame_log_reader( const tm_frame_log_reader & ) = delete;
+  tm_frame_log_reader &operator=( const tm_frame_log_reader & ) = delete;
+  ~tm_frame_log_reader() { Close(); }
+
+  //
+  // opens a recording and loads its index, if it has one
+  //
+  bool Open( const char *path )
+  {
+    Close();
+
+    File = fopen( path, "rb" );
+    if( File == nullptr ) { return false; }
+
+    if( !Read( 0, &Header, sizeof( Header ) ) || Header.Magic != tm_frame_log_magic || Header.Version != tm_frame_log_version ||
+        Header.HeaderSize < sizeof( Header ) || Header.DataEnd < Header.HeaderSize )
+    {
+      Close();
+      return false;
+    }
+
+    tm_frame_log_record record;
+    if( Header.IndexOffset != 0 && Read( Header.IndexOffset, &record, sizeof( record ) ) && record.Type == tm_frame_log_record_type::Index )
+    {
+      Index.resize( record.Size / sizeof( tm_frame_log_index_entry ) );
+      if( !Index.empty() && fread( Index.data(), sizeof( tm_frame_log_index_entry ), Index.size(), File ) != Index.size() ) { Index.clear(); }
+    }
+
+    Position = Header.HeaderSize;
+    return true;
+  }
+
+  void Close()
+  {
+    if( File != nullptr ) { fclose( File ); }
+    File = nullptr;
+    Index.clear();
+  }
+
+  const tm_frame_log_header &GetHeader() const { return Header; }
+  bool                       HasIndex()  const { return !Index.empty(); }
+
+  //
+  // moves to the last indexed frame at or before 'timestamp', the first frame without an index
+  //
+  void Seek( const tm_uint64 timestamp )
+  {
+    Position = Header.HeaderSize;
+
+    size_t first = 0, count = Index.size();
+    while( count > 0 )
+    {
+      const size_t half = count / 2;
+      if( Index[first + half].Timestamp <= timestamp ) { first += half + 1; count -= half + 1; }
+      else                                             { count = half; }
+    }
+
+    if( first > 0 ) { Position = Index[first - 1].Offset; }
+  }
+
+  //
+  // reads the next frame record and its byte stream, returns false at the end
+  //
+  bool Next( tm_frame_log_record &record, std::vector<tm_uint8> &payload )
+  {
+    while( Position + sizeof( record ) <= Header.DataEnd )
+    {
+      if( !Read( Position, &record, sizeof( record ) ) ) { return false; }
+
+      const tm_uint64 record_end = Position + tm_frame_log_record_size( record.Size );
+      if( record_end > Header.DataEnd ) { return false; }
+      Position = record_end;
+
+      if( record.Type != tm_frame_log_record_type::Frame ) { continue; }
+
+      payload.resize( record.Size );
+      return record.Size == 0 || fread( payload.data(), 1, record.Size, File ) == record.Size;
+    }
+
+    return false;
+  }
+};
+
+#endif  // TM_FRAME_LOG_H
@@ -0,0 +1,424 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// tm_telemetry_frame.h - the frame the telemetry dll sends to its consumers
+//
+// Two wire formats are supported:
+//
+//  - legacy CSV: every value multiplied by 1000 and printed as integer, separated by ';'
+//
+//  - binary: a fixed layout, little-endian datagram
+//
+//      offset  size  field
+//           0     4  Magic         'AFT2' (0x32544641)
+//           4     2  Version       tm_telemetry_frame_version
+//           6     2  Flags         tm_telemetry_frame_flag
+//           8     4  Sequence      incremented for every frame sent
+//          12     2  ChannelCount  number of channels in the channel set, width of the bitmap
+//          14     2  ValueCount    number of values that follow the bitmap
+//          16     8  SimTime       accumulated delta_time in seconds (IEEE 754 double)
+//          24   8*W  ChannelMask   W = ( ChannelCount + 63 ) / 64 words, bit i set: channel i present
+//           ..  4|8  Values        ValueCount values in ascending channel order, float or double
+//
+// Destinations with a keyframe interval send delta frames in between, with the Delta flag. They
+// carry only the channels that changed by more than their epsilon since the frame before, the
+// others keep their value. Keyframes carry every channel of the destination and no Delta flag.
+// Sequence counts the frames of that destination, a delta only applies on top of the frame with
+// the sequence before it; after a lost frame consumers wait for the next keyframe.
+// tm_telemetry_delta_encoder builds these frames, tm_telemetry_frame_state rebuilds the state.
+//
+// The Stall flag marks the first frame after a delta_time above the stall threshold of the dll.
+// Consumers that filter the values can hold or fade through the jump instead of following it.
+// Frames sent at a fixed output rate carry it while they interpolate towards that frame, rate
+// limited destinations get that frame even when it comes before their next one is due.
+//
+// The header has no dependency other than tm_external_message.h so consumers can use it as is.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_TELEMETRY_FRAME_H
+#define TM_TELEMETRY_FRAME_H
+
+#include "../input/tm_external_message.h"
+
+#include <bit>
+#include <stdio.h>
+#include <string.h>
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// constants of the binary format
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+constexpr tm_uint32 tm_telemetry_frame_magic        = 0x32544641;   // 'AFT2' in little-endian byte order
+constexpr tm_uint16 tm_telemetry_frame_version      = 1;
+constexpr tm_uint32 tm_telemetry_frame_header_size  = 24;
+constexpr tm_uint32 tm_telemetry_max_channels       = 128;
+constexpr tm_uint32 tm_telemetry_channel_mask_words = tm_telemetry_max_channels / 64;
+constexpr tm_uint32 tm_telemetry_max_datagram_size  = tm_telemetry_frame_header_size + 8 * tm_telemetry_channel_mask_words + 8 * tm_telemetry_max_channels;
+
+enum class tm_telemetry_frame_flag : tm_uint16
+{
+  None        = 0,
+  FloatValues = 1 << 0,   // values are 32 bit floats instead of doubles
+  Delta       = 1 << 1,   // only the changed channels, see above
+  Stall       = 1 << 2    // the simulation stalled before this frame, its values jump
+};
+
+enum class tm_telemetry_format : tm_uint8
+{
+  CSV,
+  Binary,
+  BinaryFloat
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// little-endian helpers, compilers turn these into plain loads and stores on x86
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+inline void tm_telemetry_write_le( tm_uint8 *p, tm_uint64 v, const tm_uint32 num_bytes )
+{
+  for( tm_uint32 i = 0; i < num_bytes; ++i )
+  {
+    p[i] = static_cast<tm_uint8>( v );
+    v >>= 8;
+  }
+}
+
+inline tm_uint64 tm_telemetry_read_le( const tm_uint8 *p, const tm_uint32 num_bytes )
+{
+  tm_uint64 v = 0;
+  for( tm_uint32 i = num_bytes; i > 0; --i )
+  {
+    v = ( v << 8 ) | p[i - 1];
+  }
+  return v;
+}
+
+inline tm_uint64 tm_telemetry_double_bits( const double d ) { tm_uint64 v; memcpy( &v, &d, 8 ); return v; }
+inline double    tm_telemetry_bits_double( const tm_uint64 v ) { double d; memcpy( &d, &v, 8 ); return d; }
+inline tm_uint32 tm_telemetry_float_bits( const float f ) { tm_uint32 v; memcpy( &v, &f, 4 ); return v; }
+inline float     tm_telemetry_bits_float( const tm_uint32 v ) { float f; memcpy( &f, &v, 4 ); return f; }
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_telemetry_frame - one frame of channel values
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_frame
+{
+public:
+  tm_uint32 Sequence     = 0;
+  tm_uint16 Flags        = 0;
+  tm_uint16 ChannelCount = 0;
+  tm_double SimTime      = 0;
+  tm_uint64 ChannelMask[tm_telemetry_channel_mask_words] = {};
+  tm_double Values[tm_telemetry_max_channels]            = {};
+
+public:
+  bool HasChannel( const tm_uint32 i ) const { return ( ChannelMask[i / 64] >> ( i % 64 ) & 1 ) != 0; }
+  void SetChannel( const tm_uint32 i, const tm_double value )
+  {
+    Values[i] = value;
+    ChannelMask[i / 64] |= tm_uint64( 1 ) << ( i % 64 );
+  }
+
+  void SetAllChannels( const tm_uint32 channel_count )
+  {
+    ChannelCount = static_cast<tm_uint16>( channel_count );
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w )
+    {
+      const tm_uint32 first = w * 64;
+      ChannelMask[w] = channel_count >= first + 64 ? ~tm_uint64( 0 ) : channel_count > first ? ( tm_uint64( 1 ) << ( channel_count - first ) ) - 1 : 0;
+    }
+  }
+
+  tm_uint32 GetNumMaskWords() const { return ( ChannelCount + 63u ) / 64u; }
+
+  tm_uint32 GetValueCount() const
+  {
+    tm_uint32 n = 0;
+    for( tm_uint32 w = 0; w < GetNumMaskWords(); ++w )
+    {
+      for( tm_uint64 m = ChannelMask[w]; m != 0; m &= m - 1 ) { ++n; }
+    }
+    return n;
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  //
+  // legacy text format, values multiplied by 1000 and separated by ';'. returns the length or 0.
+  //
+  tm_uint32 EncodeCSV( char *buffer, const tm_uint32 buffer_size ) const
+  {
+    tm_uint32 pos = 0;
+    for( tm_uint32 i = 0; i < ChannelCount; ++i )
+    {
+      if( !HasChannel( i ) ) { continue; }
+
+      const int n = snprintf( buffer + pos, buffer_size - pos, pos == 0 ? "%lld" : ";%lld", static_cast<long long>( Values[i] * 1000 ) );
+      if( n < 0 || pos + n >= buffer_size ) { return 0; }
+      pos += n;
+    }
+    return pos;
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  //
+  // binary format, returns the number of bytes written or 0 if the buffer is too small
+  //
+  tm_uint32 EncodeBinary( tm_uint8 *byte_stream, const tm_uint32 byte_stream_size_max, const bool float_values ) const
+  {
+    return EncodeBinary( byte_stream, byte_stream_size_max, float_values, ChannelMask, Flags, Sequence );
+  }
+
+  // the same with the channels of 'channel_mask' and another header, e.g. for delta frames
+  tm_uint32 EncodeBinary( tm_uint8 *byte_stream, const tm_uint32 byte_stream_size_max, const bool float_values,
+                          const tm_uint64 *channel_mask, const tm_uint16 flags_set, const tm_uint32 sequence ) const
+  {
+    const tm_uint32 num_words  = GetNumMaskWords();
+    const tm_uint32 value_size = float_values ? 4 : 8;
+
+    tm_uint32 value_count = 0;
+    for( tm_uint32 w = 0; w < num_words; ++w )
+    {
+      for( tm_uint64 m = channel_mask[w]; m != 0; m &= m - 1 ) { ++value_count; }
+    }
+
+    const tm_uint32 size = tm_telemetry_frame_header_size + 8 * num_words + value_size * value_count;
+    if( size > byte_stream_size_max ) { return 0; }
+
+    const tm_uint16 flags = static_cast<tm_uint16>( float_values ? ( flags_set | static_cast<tm_uint16>( tm_telemetry_frame_flag::FloatValues ) )
+                                                                 : ( flags_set & ~static_cast<tm_uint16>( tm_telemetry_frame_flag::FloatValues ) ) );
+
+    tm_uint8 *p = byte_stream;
+    tm_telemetry_write_le( p +  0, tm_telemetry_frame_magic, 4 );
+    tm_telemetry_write_le( p +  4, tm_telemetry_frame_version, 2 );
+    tm_telemetry_write_le( p +  6, flags, 2 );
+    tm_telemetry_write_le( p +  8, sequence, 4 );
+    tm_telemetry_write_le( p + 12, ChannelCount, 2 );
+    tm_telemetry_write_le( p + 14, value_count, 2 );
+    tm_telemetry_write_le( p + 16, tm_telemetry_double_bits( SimTime ), 8 );
+    p += tm_telemetry_frame_header_size;
+
+    for( tm_uint32 w = 0; w < num_words; ++w, p += 8 )
+    {
+      tm_telemetry_write_le( p, channel_mask[w], 8 );
+    }
+
+    for( tm_uint32 i = 0; i < ChannelCount; ++i )
+    {
+      if( ( channel_mask[i / 64] >> ( i % 64 ) & 1 ) == 0 ) { continue; }
+
+      if( float_values ) { tm_telemetry_write_le( p, tm_telemetry_float_bits( static_cast<float>( Values[i] ) ), 4 ); }
+      else               { tm_telemetry_write_le( p, tm_telemetry_double_bits( Values[i] ), 8 ); }
+      p += value_size;
+    }
+
+    return size;
+  }
+
+  //
+  // decodes a binary frame. only channels present in the datagram are written to Values, all other
+  // values keep their previous content.
+  //
+  bool DecodeBinary( const tm_uint8 *byte_stream, const tm_uint32 byte_stream_size )
+  {
+    if( byte_stream_size < tm_telemetry_frame_header_size )                                      { return false; }
+    if( tm_telemetry_read_le( byte_stream, 4 ) != tm_telemetry_frame_magic )                     { return false; }
+    if( tm_telemetry_read_le( byte_stream + 4, 2 ) != tm_telemetry_frame_version )               { return false; }
+
+    const auto flags         = static_cast<tm_uint16>( tm_telemetry_read_le( byte_stream +  6, 2 ) );
+    const auto channel_count = static_cast<tm_uint16>( tm_telemetry_read_le( byte_stream + 12, 2 ) );
+    const auto value_count   = static_cast<tm_uint32>( tm_telemetry_read_le( byte_stream + 14, 2 ) );
+    const bool float_values  = ( flags & static_cast<tm_uint16>( tm_telemetry_frame_flag::FloatValues ) ) != 0;
+    const auto num_words     = ( channel_count + 63u ) / 64u;
+    const auto value_size    = float_values ? 4u : 8u;
+
+    if( channel_count > tm_telemetry_max_channels )                                              { return false; }
+    if( byte_stream_size < tm_telemetry_frame_header_size + 8 * num_words + value_size * value_count ) { return false; }
+
+    Flags        = flags;
+    Sequence     = static_cast<tm_uint32>( tm_telemetry_read_le( byte_stream + 8, 4 ) );
+    ChannelCount = channel_count;
+    SimTime      = tm_telemetry_bits_double( tm_telemetry_read_le( byte_stream + 16, 8 ) );
+
+    const tm_uint8 *p = byte_stream + tm_telemetry_frame_header_size;
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w )
+    {
+      ChannelMask[w] = w < num_words ? tm_telemetry_read_le( p + 8 * w, 8 ) : 0;
+    }
+    p += 8 * num_words;
+
+    if( channel_count % 64 != 0 ) { ChannelMask[num_words - 1] &= ( tm_uint64( 1 ) << ( channel_count % 64 ) ) - 1; }
+    if( GetValueCount() != value_count ) { return false; }
+
+    for( tm_uint32 i = 0; i < channel_count; ++i )
+    {
+      if( !HasChannel( i ) ) { continue; }
+
+      Values[i] = float_values ? tm_telemetry_bits_float( static_cast<tm_uint32>( tm_telemetry_read_le( p, 4 ) ) )
+                               : tm_telemetry_bits_double( tm_telemetry_read_le( p, 8 ) );
+      p += value_size;
+    }
+
+    return true;
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_telemetry_delta_encoder - keyframes and delta frames for one destination
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_delta_encoder
+{
+private:
+  tm_double Reference[tm_telemetry_max_channels] = {};      // the values the consumer has
+  tm_double Epsilon[tm_telemetry_max_channels]   = {};
+  tm_uint64 ChannelMask[tm_telemetry_channel_mask_words] = {};
+  tm_uint64 ReferenceMask[tm_telemetry_channel_mask_words] = {};
+  tm_uint16 ReferenceChannelCount = 0;
+  tm_uint32 KeyframeInterval      = 60;
+  tm_uint32 FramesSinceKeyframe   = 0;
+  tm_uint32 Sequence              = 0;
+  bool      NeedKeyframe          = true;
+
+public:
+  //
+  // a keyframe every 'keyframe_interval' frames, channels outside 'channel_mask' are not sent.
+  // a change of channel i is sent when it is larger than epsilons[i], all changes without them.
+  //
+  void Configure( const tm_uint32 keyframe_interval, const tm_uint64 *channel_mask, const tm_double *epsilons, const tm_uint32 num_epsilons )
+  {
+    KeyframeInterval = keyframe_interval > 0 ? keyframe_interval : 1;
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w ) { ChannelMask[w] = channel_mask != nullptr ? channel_mask[w] : ~tm_uint64( 0 ); }
+    for( tm_uint32 i = 0; i < tm_telemetry_max_channels; ++i ) { Epsilon[i] = epsilons != nullptr && i < num_epsilons ? epsilons[i] : 0; }
+    Sequence     = 0;
+    NeedKeyframe = true;
+  }
+
+  // the next frame is a keyframe, e.g. when a consumer asks for one
+  void RequestKeyframe() { NeedKeyframe = true; }
+
+  //
+  // encodes the next frame of the destination, returns the number of bytes or 0 if the buffer is
+  // too small. a delta without changes is still sent, it keeps the sequence and SimTime going.
+  //
+  tm_uint32 Encode( const tm_telemetry_frame &frame, tm_uint8 *byte_stream, const tm_uint32 byte_stream_size_max, const bool float_values )
+  {
+    tm_uint64 mask[tm_telemetry_channel_mask_words];
+    bool      same_channels = frame.ChannelCount == ReferenceChannelCount;
+    for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w )
+    {
+      mask[w]        = frame.ChannelMask[w] & ChannelMask[w];
+      same_channels &= mask[w] == ReferenceMask[w];
+    }
+
+    const bool keyframe = NeedKeyframe || !same_channels || FramesSinceKeyframe + 1 >= KeyframeInterval;
+    tm_uint16  flags    = static_cast<tm_uint16>( frame.Flags & ~static_cast<tm_uint16>( tm_telemetry_frame_flag::Delta ) );
+
+    if( keyframe )
+    {
+      for( tm_uint32 w = 0; w < tm_telemetry_channel_mask_words; ++w ) { ReferenceMask[w] = mask[w]; }
+      for( tm_uint32 i = 0; i < frame.ChannelCount; ++i ) { Reference[i] = frame.Values[i]; }
+      ReferenceChannelCount = frame.ChannelCount;
+      FramesSinceKeyframe   = 0;
+      NeedKeyframe          = false;
+    }
+    else
+    {
+      // the changes against what the consumer has, so slow drifts add up until they are sent
+      for( tm_uint32 w = 0; w < frame.GetNumMaskWords(); ++w )
+      {
+        tm_uint64 changed = 0;
+        for( tm_uint64 m = mask[w]; m != 0; m &= m - 1 )
+        {
+          const tm_uint32 bit = static_cast<tm_uint32>( std::countr_zero( m ) );
+          const tm_uint32 i   = w * 64 + bit;
+          const tm_double d   = frame.Values[i] - Reference[i];
+          if( d <= Epsilon[i] && d >= -Epsilon[i] ) { continue; }
+
+          changed     |= tm_uint64( 1 ) << bit;
+          Reference[i] = frame.Values[i];
+        }
+        mask[w] = changed;
+      }
+
+      flags = static_cast<tm_uint16>( flags | static_cast<tm_uint16>( tm_telemetry_frame_flag::Delta ) );
+      ++FramesSinceKeyframe;
+    }
+
+    const tm_uint32 size = frame.EncodeBinary( byte_stream, byte_stream_size_max, float_values, mask, flags, Sequence );
+    if( size == 0 ) { NeedKeyframe = true; return 0; }
+
+    ++Sequence;
+    return size;
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_telemetry_frame_state - the consumer side, the full state from keyframes and deltas
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_frame_state
+{
+private:
+  tm_telemetry_frame Frame;
+  bool               Valid = false;
+
+public:
+  //
+  // applies a received binary frame, returns true if GetFrame() holds the complete state after
+  // it. a delta that does not follow the frame before is dropped until the next keyframe.
+  //
+  bool Apply( const tm_uint8 *byte_stream, const tm_uint32 byte_stream_size )
+  {
+    if( byte_stream_size < tm_telemetry_frame_header_size ) { return Valid; }
+
+    const auto flags    = static_cast<tm_uint16>( tm_telemetry_read_le( byte_stream + 6, 2 ) );
+    const auto sequence = static_cast<tm_uint32>( tm_telemetry_read_le( byte_stream + 8, 4 ) );
+    const bool delta    = ( flags & static_cast<tm_uint16>( tm_telemetry_frame_flag::Delta ) ) != 0;
+
+    if( delta && ( !Valid || sequence != Frame.Sequence + 1 || tm_telemetry_read_le( byte_stream + 12, 2 ) != Frame.ChannelCount ) )
+    {
+      Valid = false;
+      return false;
+    }
+
+    // a delta keeps the channels of the keyframe, the values it does not carry stay
+    tm_uint64 channel_mask[tm_telemetry_channel_mask_words];
+    memcpy( channel_mask, Frame.ChannelMask, sizeof( channel_mask ) );
+
+    if( !Frame.DecodeBinary( byte_stream, byte_stream_size ) )
+    {
+      Valid = false;
+      return false;
+    }
+
+    if( delta ) { memcpy( Frame.ChannelMask, channel_mask, sizeof( channel_mask ) ); }
+    Valid = true;
+    return true;
+  }
+
+  bool                      IsValid()  const { return Valid; }
+  const tm_telemetry_frame &GetFrame() const { return Frame; }
+};
+
+#endif  // TM_TELEMETRY_FRAME_H
@@ -0,0 +1,520 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// tm_telemetry_shm.h - shared memory transport for consumers on the same machine
+//
+// The dll publishes every frame into a named shared memory region, a ring of fixed size slots
+// that each hold one binary frame as described in tm_telemetry_frame.h, always with all channels
+// and double values. Consumers read the slots directly, neither side takes a lock and neither
+// side makes a system call on the fast path.
+//
+//  region header, 192 bytes
+//
+//      offset  size  field
+//           0     4  Magic          'AFSM' (0x4d534641)
+//           4     2  Version        tm_telemetry_shm_version
+//           6     2  HeaderSize     192, the first slot starts here
+//           8     4  SlotCount      number of slots
+//          12     4  SlotSize       bytes from one slot to the next, a multiple of 64
+//          16     4  Closed         set when the writer closed the region
+//          20    44  reserved       0
+//          64     8  Published      number of frames published, atomic
+//         128     4  Signal         incremented for every frame, the word waiting readers sleep on
+//         132     4  Waiters        number of readers sleeping on Signal
+//
+//  slot, SlotSize bytes
+//
+//      offset  size  field
+//           0     8  Sequence       2 * n + 1 while frame n is written, 2 * n + 2 when it is complete
+//           8     4  Size           bytes of the frame
+//          12     4  reserved       0
+//          16  Size  Frame          binary frame
+//
+// Frame n goes into slot n % SlotCount. A reader reads Sequence, copies the frame and reads
+// Sequence again, the copy is valid if both are 2 * n + 2. Size and Frame are written and read
+// with relaxed atomic accesses, Frame in 8 byte words, so a copy that races with the writer is a
+// torn copy that gets dropped and not a data race. Readers that fall more than SlotCount
+// frames behind skip ahead and count the frames they missed.
+//
+// Readers poll with ReadNext() or ReadLatest(), or sleep in Wait() until the next frame. The
+// writer only makes a system call to wake them when one is actually sleeping. Waiting uses a futex
+// on Linux and a named semaphore on Windows, other platforms poll.
+//
+// The region is named "Local\<name>" on Windows and "/<name>" with POSIX shm_open elsewhere.
+// A writer that closes the region sets Closed, readers then open it again to follow a new writer.
+//
+// A consumer needs no more than
+//
+//   tm_telemetry_shm_reader reader;
+//   tm_telemetry_frame      frame;
+//   reader.Open( "Aerofly_FS_2_Telemetry" );
+//   for( ;; )
+//   {
+//     const tm_telemetry_shm_result result = reader.ReadNext( frame );
+//     if(      result == tm_telemetry_shm_result::Frame )  { ... frame.Values ... }
+//     else if( result == tm_telemetry_shm_result::Closed ) { reader.Open( "Aerofly_FS_2_Telemetry" ); }
+//     else                                                 { reader.Wait( 100 ); }
+//   }
+//
+// The header has no dependency other than tm_telemetry_frame.h so consumers can use it as is.
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TM_TELEMETRY_SHM_H
+#define TM_TELEMETRY_SHM_H
+
+#include "tm_telemetry_frame.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(WIN32) || defined(WIN64)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <time.h>
+  #include <unistd.h>
+  #if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+  #endif
+#endif
+
+
+constexpr tm_uint32 tm_telemetry_shm_magic       = 0x4d534641;   // 'AFSM' in little-endian byte order
+constexpr tm_uint16 tm_telemetry_shm_version     = 1;
+constexpr tm_uint32 tm_telemetry_shm_slot_header = 16;
+constexpr tm_uint32 tm_telemetry_shm_slot_size   = ( tm_telemetry_shm_slot_header + tm_telemetry_max_datagram_size + 63 ) / 64 * 64;
+constexpr const char *tm_telemetry_shm_default_name = "Aerofly_FS_2_Telemetry";
+
+struct tm_telemetry_shm_header
+{
+  tm_uint32              Magic;
+  tm_uint16              Version;
+  tm_uint16              HeaderSize;
+  tm_uint32              SlotCount;
+  tm_uint32              SlotSize;
+  std::atomic<tm_uint32> Closed;
+  tm_uint8               Reserved[44];
+  alignas( 64 ) std::atomic<tm_uint64> Published;
+  alignas( 64 ) std::atomic<tm_uint32> Signal;
+  std::atomic<tm_uint32> Waiters;
+};
+
+struct tm_telemetry_shm_slot
+{
+  std::atomic<tm_uint64> Sequence;
+  std::atomic<tm_uint32> Size;
+  tm_uint32              Reserved;
+  alignas( 8 ) tm_uint8  Frame[tm_telemetry_shm_slot_size - tm_telemetry_shm_slot_header];
+};
+
+static_assert( sizeof( tm_telemetry_shm_header ) == 192, "unexpected size of tm_telemetry_shm_header" );
+static_assert( sizeof( tm_telemetry_shm_slot ) == tm_telemetry_shm_slot_size, "unexpected size of tm_telemetry_shm_slot" );
+static_assert( std::atomic<tm_uint64>::is_always_lock_free && std::atomic<tm_uint32>::is_always_lock_free, "shared atomics have to be lock-free" );
+static_assert( offsetof( tm_telemetry_shm_slot, Frame ) == tm_telemetry_shm_slot_header && sizeof( tm_telemetry_shm_slot::Frame ) % 8 == 0, "unexpected layout of tm_telemetry_shm_slot" );
+
+//
+// copies 'size' bytes into or out of the Frame of a slot word by word with relaxed atomics
+//
+inline void tm_telemetry_shm_store_frame( tm_telemetry_shm_slot &slot, const tm_uint8 *data, const tm_uint32 size )
+{
+  for( tm_uint32 i = 0; i < size; i += 8 )
+  {
+    tm_uint64 word = 0;
+    memcpy( &word, data + i, size - i < 8 ? size - i : 8 );
+    std::atomic_ref<tm_uint64>( *reinterpret_cast<tm_uint64*>( slot.Frame + i ) ).store( word, std::memory_order_relaxed );
+  }
+}
+
+inline void tm_telemetry_shm_load_frame( tm_telemetry_shm_slot &slot, tm_uint8 *data, const tm_uint32 size )
+{
+  for( tm_uint32 i = 0; i < size; i += 8 )
+  {
+    const tm_uint64 word = std::atomic_ref<tm_uint64>( *reinterpret_cast<tm_uint64*>( slot.Frame + i ) ).load( std::memory_order_relaxed );
+    memcpy( data + i, &word, size - i < 8 ? size - i : 8 );
+  }
+}
+
+enum class tm_telemetry_shm_result : tm_uint8
+{
+  Frame,        // a frame was read
+  NoFrame,      // nothing new yet
+  Closed        // the writer is gone, open the region again
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// the mapping of the region and the wake up of sleeping readers, the only platform specific part
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_shm_mapping
+{
+private:
+#if defined(WIN32) || defined(WIN64)
+  HANDLE    Mapping   = nullptr;
+  HANDLE    Semaphore = nullptr;
+#else
+  char      Name[128] = {};
+  bool      Owner     = false;
+#endif
+  tm_uint8 *Data      = nullptr;
+  tm_uint64 Size      = 0;
+
+public:
+  tm_telemetry_shm_mapping() = default;
+  tm_telemetry_shm_mapping( const tm_telemetry_shm_mapping & ) = delete;
+  tm_telemetry_shm_mapping &operator=( const tm_telemetry_shm_mapping & ) = delete;
+  ~tm_telemetry_shm_mapping() { Close(); }
+
+  bool      IsOpen()  const { return Data != nullptr; }
+  tm_uint8 *GetData() const { return Data; }
+  tm_uint64 GetSize() const { return Size; }
+
+  //
+  // creates the region, or opens the existing one when 'size' is 0
+  //
+  bool Open( const char *name, const tm_uint64 size )
+  {
+    Close();
+
+#if defined(WIN32) || defined(WIN64)
+    char mapping_name[160], semaphore_name[160];
+    snprintf( mapping_name, sizeof( mapping_name ), "Local\\%s", name );
+    snprintf( semaphore_name, sizeof( semaphore_name ), "Local\\%s.signal", name );
+
+    Mapping = size > 0 ? CreateFileMappingA( INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>( size >> 32 ), static_cast<DWORD>( size ), mapping_name )
+                       : OpenFileMappingA( FILE_MAP_ALL_ACCESS, FALSE, mapping_name );
+    Semaphore = CreateSemaphoreA( nullptr, 0, 0x7fffffff, semaphore_name );
+    if( Mapping == nullptr || Semaphore == nullptr ) { Close(); return false; }
+
+    Data = static_cast<tm_uint8*>( MapViewOfFile( Mapping, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>( size ) ) );
+    if( Data == nullptr ) { Close(); return false; }
+
+    MEMORY_BASIC_INFORMATION info = {};
+    VirtualQuery( Data, &info, sizeof( info ) );
+    Size = size > 0 ? size : info.RegionSize;
+#else
+    if( snprintf( Name, sizeof( Name ), "/%s", name ) >= static_cast<int>( sizeof( Name ) ) ) { return false; }
+
+    // a region left behind by a writer that crashed is replaced, its readers see no new frames
+    // and have to open the region again
+    if( size > 0 ) { shm_unlink( Name ); }
+
+    const int file = size > 0 ? shm_open( Name, O_RDWR | O_CREAT | O_EXCL, 0600 ) : shm_open( Name, O_RDWR, 0 );
+    if( file < 0 ) { return false; }
+
+    Owner = size > 0;
+    off_t file_size = static_cast<off_t>( size );
+    if( Owner ? ftruncate( file, file_size ) != 0 : ( file_size = lseek( file, 0, SEEK_END ) ) <= 0 )
+    {
+      close( file );
+      Close();
+      return false;
+    }
+
+    void *data = mmap( nullptr, static_cast<size_t>( file_size ), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0 );
+    close( file );
+    if( data == MAP_FAILED ) { Close(); return false; }
+
+    Data = static_cast<tm_uint8*>( data );
+    Size = static_cast<tm_uint64>( file_size );
+#endif
+    return true;
+  }
+
+  void Close()
+  {
+#if defined(WIN32) || defined(WIN64)
+    if( Data != nullptr )      { UnmapViewOfFile( Data ); }
+    if( Mapping != nullptr )   { CloseHandle( Mapping ); }
+    if( Semaphore != nullptr ) { CloseHandle( Semaphore ); }
+    Mapping   = nullptr;
+    Semaphore = nullptr;
+#else
+    if( Data != nullptr ) { munmap( Data, static_cast<size_t>( Size ) ); }
+    if( Owner )           { shm_unlink( Name ); }
+    Owner = false;
+#endif
+    Data = nullptr;
+    Size = 0;
+  }
+
+  // wakes 'count' readers sleeping in Wait()
+  void Wake( std::atomic<tm_uint32> &signal, const tm_uint32 count ) const
+  {
+#if defined(WIN32) || defined(WIN64)
+    (void)signal;
+    ReleaseSemaphore( Semaphore, static_cast<LONG>( count ), nullptr );
+#elif defined(__linux__)
+    (void)count;
+    syscall( SYS_futex, reinterpret_cast<tm_uint32*>( &signal ), FUTEX_WAKE, 0x7fffffff, nullptr, nullptr, 0 );
+#else
+    (void)signal;
+    (void)count;
+#endif
+  }
+
+  // sleeps while 'signal' is 'value', at most 'timeout_ms' milliseconds. may return early.
+  void Wait( std::atomic<tm_uint32> &signal, const tm_uint32 value, const tm_uint32 timeout_ms ) const
+  {
+#if defined(WIN32) || defined(WIN64)
+    (void)value;
+    if( signal.load( std::memory_order_acquire ) == value ) { WaitForSingleObject( Semaphore, timeout_ms ); }
+#elif defined(__linux__)
+    const timespec timeout = { static_cast<time_t>( timeout_ms / 1000 ), static_cast<long>( timeout_ms % 1000 ) * 1000000 };
+    syscall( SYS_futex, reinterpret_cast<tm_uint32*>( &signal ), FUTEX_WAIT, value, &timeout, nullptr, 0 );
+#else
+    (void)timeout_ms;
+    const timespec pause = { 0, 100000 };
+    if( signal.load( std::memory_order_acquire ) == value ) { nanosleep( &pause, nullptr ); }
+#endif
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_telemetry_shm_writer, used by the dll
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_shm_writer
+{
+private:
+  tm_telemetry_shm_mapping Mapping;
+  tm_telemetry_shm_header *Header    = nullptr;
+  tm_telemetry_shm_slot   *Slots     = nullptr;
+  tm_uint32                SlotCount = 0;
+  tm_uint64                Published = 0;
+  tm_uint8                 Encoded[tm_telemetry_max_datagram_size];
+
+public:
+  bool      IsOpen()       const { return Header != nullptr; }
+  tm_uint64 GetPublished() const { return Published; }
+
+  bool Open( const char *name, const tm_uint32 slot_count )
+  {
+    Close();
+    if( slot_count == 0 || !Mapping.Open( name, sizeof( tm_telemetry_shm_header ) + static_cast<tm_uint64>( slot_count ) * sizeof( tm_telemetry_shm_slot ) ) ) { return false; }
+
+    // a new mapping is zero. on windows a mapping that readers still hold is opened again, the
+    // frames continue where the last writer stopped so the readers just go on.
+    Header    = reinterpret_cast<tm_telemetry_shm_header*>( Mapping.GetData() );
+    Slots     = reinterpret_cast<tm_telemetry_shm_slot*>( Mapping.GetData() + sizeof( tm_telemetry_shm_header ) );
+    SlotCount = slot_count;
+    Published = 0;
+
+    if( Header->Magic == tm_telemetry_shm_magic )
+    {
+      if( Header->Version != tm_telemetry_shm_version || Header->SlotCount != slot_count || Header->SlotSize != sizeof( tm_telemetry_shm_slot ) )
+      {
+        Header = nullptr;
+        Mapping.Close();
+        return false;
+      }
+
+      Published = Header->Published.load( std::memory_order_acquire );
+      Header->Closed.store( 0, std::memory_order_release );
+    }
+
+    Header->Version    = tm_telemetry_shm_version;
+    Header->HeaderSize = sizeof( tm_telemetry_shm_header );
+    Header->SlotCount  = slot_count;
+    Header->SlotSize   = sizeof( tm_telemetry_shm_slot );
+    std::atomic_thread_fence( std::memory_order_release );
+    reinterpret_cast<std::atomic<tm_uint32>*>( &Header->Magic )->store( tm_telemetry_shm_magic, std::memory_order_release );
+    return true;
+  }
+
+  void Close()
+  {
+    if( Header != nullptr )
+    {
+      Header->Closed.store( 1, std::memory_order_release );
+      Header->Signal.fetch_add( 1, std::memory_order_seq_cst );
+      Mapping.Wake( Header->Signal, Header->Waiters.load( std::memory_order_seq_cst ) );
+    }
+
+    Mapping.Close();
+    Header = nullptr;
+    Slots  = nullptr;
+  }
+
+  //
+  // encodes the frame into the next slot and wakes sleeping readers
+  //
+  bool Publish( const tm_telemetry_frame &frame )
+  {
+    if( Header == nullptr ) { return false; }
+
+    const tm_uint32 size = frame.EncodeBinary( Encoded, sizeof( Encoded ), false );
+
+    tm_telemetry_shm_slot &slot = Slots[Published % SlotCount];
+    slot.Sequence.store( 2 * Published + 1, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+
+    tm_telemetry_shm_store_frame( slot, Encoded, size );
+    slot.Size.store( size, std::memory_order_relaxed );
+
+    slot.Sequence.store( 2 * Published + 2, std::memory_order_release );
+    Header->Published.store( ++Published, std::memory_order_release );
+
+    // pairs with the increment of Waiters in tm_telemetry_shm_reader::Wait
+    Header->Signal.fetch_add( 1, std::memory_order_seq_cst );
+    const tm_uint32 waiters = Header->Waiters.load( std::memory_order_seq_cst );
+    if( waiters > 0 ) { Mapping.Wake( Header->Signal, waiters ); }
+    return size > 0;
+  }
+};
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// class tm_telemetry_shm_reader, for consumers
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+class tm_telemetry_shm_reader
+{
+private:
+  tm_telemetry_shm_mapping Mapping;
+  tm_telemetry_shm_header *Header    = nullptr;
+  tm_telemetry_shm_slot   *Slots     = nullptr;
+  tm_uint32                SlotCount = 0;
+  tm_uint64                Next      = 0;      // the frame ReadNext() returns
+  tm_uint64                Skipped   = 0;      // frames overwritten before they were read
+  tm_uint8                 Copy[tm_telemetry_max_datagram_size];
+
+  // copies frame n out of its slot, false if it was overwritten meanwhile
+  bool ReadSlot( const tm_uint64 n, tm_telemetry_frame &frame )
+  {
+    tm_telemetry_shm_slot &slot = Slots[n % SlotCount];
+
+    const tm_uint64 before = slot.Sequence.load( std::memory_order_acquire );
+    if( before != 2 * n + 2 ) { return false; }
+
+    const tm_uint32 size = slot.Size.load( std::memory_order_relaxed );
+    if( size > sizeof( Copy ) || size > sizeof( slot.Frame ) ) { return false; }
+    tm_telemetry_shm_load_frame( slot, Copy, size );
+
+    std::atomic_thread_fence( std::memory_order_acquire );
+    if( slot.Sequence.load( std::memory_order_relaxed ) != before ) { return false; }
+
+    return frame.DecodeBinary( Copy, size );
+  }
+
+public:
+  bool      IsOpen()     const { return Header != nullptr; }
+  tm_uint64 GetSkipped() const { return Skipped; }
+
+  //
+  // opens the region of a running writer, the first ReadNext() returns the latest frame
+  //
+  bool Open( const char *name = tm_telemetry_shm_default_name )
+  {
+    Close();
+    if( !Mapping.Open( name, 0 ) ) { return false; }
+
+    auto *header = reinterpret_cast<tm_telemetry_shm_header*>( Mapping.GetData() );
+    if( Mapping.GetSize() < sizeof( tm_telemetry_shm_header ) ||
+        reinterpret_cast<std::atomic<tm_uint32>*>( &header->Magic )->load( std::memory_order_acquire ) != tm_telemetry_shm_magic ||
+        header->Version != tm_telemetry_shm_version || header->SlotSize != sizeof( tm_telemetry_shm_slot ) ||
+        Mapping.GetSize() < header->HeaderSize + static_cast<tm_uint64>( header->SlotCount ) * header->SlotSize || header->SlotCount == 0 )
+    {
+      Mapping.Close();
+      return false;
+    }
+
+    Header    = header;
+    Slots     = reinterpret_cast<tm_telemetry_shm_slot*>( Mapping.GetData() + header->HeaderSize );
+    SlotCount = header->SlotCount;
+    Skipped   = 0;
+
+    const tm_uint64 published = Header->Published.load( std::memory_order_acquire );
+    Next = published > 0 ? published - 1 : 0;
+    return true;
+  }
+
+  void Close()
+  {
+    Mapping.Close();
+    Header = nullptr;
+    Slots  = nullptr;
+  }
+
+  //
+  // the frame after the one read last, in order. frames that were overwritten are skipped.
+  //
+  tm_telemetry_shm_result ReadNext( tm_telemetry_frame &frame )
+  {
+    if( Header == nullptr || Header->Closed.load( std::memory_order_acquire ) != 0 ) { return tm_telemetry_shm_result::Closed; }
+
+    for( ;; )
+    {
+      const tm_uint64 published = Header->Published.load( std::memory_order_acquire );
+      if( Next >= published ) { return tm_telemetry_shm_result::NoFrame; }
+
+      // the oldest frame that may still be there, the writer could be in the slot after it
+      const tm_uint64 oldest = published > SlotCount - 1 ? published - ( SlotCount - 1 ) : 0;
+      if( Next < oldest )
+      {
+        Skipped += oldest - Next;
+        Next     = oldest;
+      }
+
+      if( ReadSlot( Next, frame ) )
+      {
+        ++Next;
+        return tm_telemetry_shm_result::Frame;
+      }
+
+      // overwritten while it was copied, skip it
+      ++Skipped;
+      ++Next;
+    }
+  }
+
+  //
+  // the newest frame, whatever was published before it is skipped
+  //
+  tm_telemetry_shm_result ReadLatest( tm_telemetry_frame &frame )
+  {
+    if( Header != nullptr )
+    {
+      const tm_uint64 published = Header->Published.load( std::memory_order_acquire );
+      if( published > Next + 1 )
+      {
+        Skipped += published - 1 - Next;
+        Next     = published - 1;
+      }
+    }
+
+    return ReadNext( frame );
+  }
+
+  //
+  // sleeps until a frame after the one read last was published or 'timeout_ms' passed
+  //
+  void Wait( const tm_uint32 timeout_ms )
+  {
+    if( Header == nullptr ) { return; }
+
+    Header->Waiters.fetch_add( 1, std::memory_order_seq_cst );
+    const tm_uint32 signal = Header->Signal.load( std::memory_order_seq_cst );
+    if( Header->Published.load( std::memory_order_seq_cst ) <= Next && Header->Closed.load( std::memory_order_acquire ) == 0 )
+    {
+      Mapping.Wait( Header->Signal, signal, timeout_ms );
+    }
+    Header->Waiters.fetch_sub( 1, std::memory_order_relaxed );
+  }
+};
+
+#endif  // TM_TELEMETRY_SHM_H